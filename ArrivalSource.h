@@ -0,0 +1,430 @@
+/**
+ *  @file    ArrivalSource.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _ARRIVAL_SOURCE
+#define _ARRIVAL_SOURCE
+
+#include <string>
+#include <fstream>
+#include <regex>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "ReadyQueue.h"
+#include "RandomSource.h"
+// Process.h included with ReadyQueue.h
+
+
+/**
+ * @brief      Class for the schedule of process arrivals into the ready queue.
+ *
+ * The processes parsed from the meta data file are kept as a workload. The
+ * schedule is a list of (time, workload index) pairs sorted by time. The
+ * runner delivers every arrival that is due on the simulator's clock, as
+ * many as admission control has room for. Arrivals without room stay in the
+ * schedule, which is the pending list, or are rejected. A throttled source
+ * pauses while its arrivals are held, pushing back the rest of the schedule.
+ */
+class ArrivalSource
+{
+public:
+    // Struct for one scheduled arrival
+    struct Arrival {
+        long long time; // microseconds from simulation start
+        int workloadIndex; // index of the process in the workload
+    };
+
+    // SETTER FUNCTIONS
+    void setWorkload(const std::vector<Process>& workload);
+
+    // GETTER FUNCTIONS
+    bool hasPending() const;
+    long long nextArrivalTime() const;
+    int getWorkloadSize() const;
+    long getNumHeld() const;
+    long getNumRejected() const;
+    double getMeanHoldMicros() const;
+    long long getMaxHoldMicros() const;
+
+    // PUBLIC FUNCTIONS
+    void buildReload(int reloadCount, int reloadIntervalMs);
+    void buildSchedule(std::string arrivalFilePath);
+    void buildPoisson(double ratePerSec, long count, unsigned long long seed);
+    int deliverDue(long long now, ReadyQueue& readyQ, int room, bool throttle);
+    int rejectDue(long long now);
+    void holdDue(long long now);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // Default constructor
+    ArrivalSource() {
+        next_ = 0;
+        heldEnd_ = 0;
+        delayMicros_ = 0;
+        numHeld_ = 0;
+        numRejected_ = 0;
+        totalHoldMicros_ = 0;
+        maxHoldMicros_ = 0;
+    }
+
+private:
+    // PRIVATE DATA
+    std::vector<Process> workload_; // processes parsed from the meta data file
+    std::vector<Arrival> arrivals_; // sorted by time
+    unsigned int next_; // index of the next arrival to deliver
+    unsigned int heldEnd_; // arrivals before this index found no room when due
+    long long delayMicros_; // added to every arrival not delivered, by throttling
+    long numHeld_; // arrivals delivered after their time for lack of room
+    long numRejected_;
+    long long totalHoldMicros_;
+    long long maxHoldMicros_;
+
+    // PRIVATE FUNCTIONS
+    void addArrival(long long time, int workloadIndex);
+    void sortArrivals();
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets the processes that arrivals are copied from.
+ *
+ * @param[in]  workload  (std::vector<Process>) The parsed processes
+ */
+void ArrivalSource::setWorkload(const std::vector<Process>& workload) {
+    workload_ = workload;
+    arrivals_.clear();
+    next_ = 0;
+    heldEnd_ = 0;
+    delayMicros_ = 0;
+}
+
+/**
+ * @brief      Checks for arrivals not yet delivered.
+ *
+ * @return     true if arrivals remain.
+ */
+bool ArrivalSource::hasPending() const {
+    return next_ < arrivals_.size();
+}
+
+/**
+ * @brief      Gets the time of the next arrival. Only valid if hasPending().
+ *
+ * @return     (long long) The time in microseconds.
+ */
+long long ArrivalSource::nextArrivalTime() const {
+    return arrivals_[next_].time + delayMicros_;
+}
+
+/**
+ * @brief      Gets the number of processes in the workload.
+ *
+ * @return     (int) The number of processes.
+ */
+int ArrivalSource::getWorkloadSize() const {
+    return workload_.size();
+}
+
+/**
+ * @brief      Schedules the whole workload at time zero and again every
+ *             reload interval, reloadCount times.
+ *
+ * @param[in]  reloadCount       (int) The number of reloads after the first load
+ * @param[in]  reloadIntervalMs  (int) The milliseconds between loads
+ */
+void ArrivalSource::buildReload(int reloadCount, int reloadIntervalMs) {
+    for (int load = 0; load <= reloadCount; load++) {
+        for (unsigned int i = 0; i < workload_.size(); i++) {
+            addArrival((long long)load * reloadIntervalMs * 1000, i);
+        }
+    }
+}
+
+/**
+ * @brief      Schedules each process in the workload once.
+ *
+ * A process arrives at the time in the arrival file if one is given,
+ * otherwise at the time of its A{begin}@t annotation, otherwise at zero.
+ *
+ * Arrival file format:
+ *     Start Process Arrival Schedule
+ *     Process <number>: <milliseconds>
+ *     End Process Arrival Schedule
+ *
+ * @param[in]  arrivalFilePath  (std::string) The arrival file path, may be empty
+ */
+void ArrivalSource::buildSchedule(std::string arrivalFilePath) {
+    std::vector<long long> times(workload_.size(), -1);
+
+    for (unsigned int i = 0; i < workload_.size(); i++) {
+        times[i] = workload_[i].getArrivalTime();
+    }
+
+    if (!arrivalFilePath.empty()) {
+        std::ifstream inputFile(arrivalFilePath.c_str());
+
+        if (inputFile.fail()) {
+            // throw exception
+            throw std::logic_error("ArrivalSource Class: Incorrect Arrival File Path");
+        }
+
+        /* Regex:
+                ([0-9]+) the process number and the arrival time are held
+                    as sub_matches
+        */
+        std::regex arrivalRE("^[\\s]*Process[\\s]+([0-9]+)[\\s]*:[\\s]*([0-9]+)[\\s]*$");
+        std::smatch collectedInfo;
+        std::string fullLine;
+
+        while (std::getline(inputFile, fullLine)) {
+            if (!std::regex_match(fullLine, collectedInfo, arrivalRE)) {
+                continue;
+            }
+
+            unsigned long processNumber = atol(collectedInfo.str(1).c_str());
+
+            if ((processNumber < 1) || (processNumber > workload_.size())) {
+                // throw exception
+                throw std::logic_error("ArrivalSource Class: Arrival For Unknown Process");
+            }
+
+            times[processNumber - 1] = atoll(collectedInfo.str(2).c_str()) * 1000;
+        }
+
+        inputFile.close();
+    }
+
+    for (unsigned int i = 0; i < workload_.size(); i++) {
+        addArrival((times[i] < 0) ? 0 : times[i], i);
+    }
+
+    sortArrivals();
+}
+
+/**
+ * @brief      Schedules open-loop arrivals with exponential gaps, cycling
+ *             through the processes of the workload.
+ *
+ * @param[in]  ratePerSec  (double) The mean arrivals per second
+ * @param[in]  count       (long) The number of arrivals, 0 for one per process
+ * @param[in]  seed        (unsigned long long) The random seed
+ */
+void ArrivalSource::buildPoisson(double ratePerSec, long count, unsigned long long seed) {
+    if (workload_.empty()) {
+        return;
+    }
+    if (count == 0) {
+        count = workload_.size();
+    }
+
+    RandomSource rng(seed);
+    double meanGapMicros = 1000000.0 / ratePerSec;
+    double arrivalTime = 0;
+
+    for (long i = 0; i < count; i++) {
+        arrivalTime += rng.nextExponential(meanGapMicros);
+        addArrival((long long)arrivalTime, i % workload_.size());
+    }
+}
+
+/**
+ * @brief      Moves the arrivals that are due into the ready queue, numbering
+ *             the processes in order of arrival.
+ *
+ * @param[in]  now               (long long) The current time in microseconds
+ * @param      readyQ            (ReadyQueue&) Reference to the ready queue
+ * @param[in]  room              (int) The most processes to deliver, -1 for
+ *                               no limit. Due arrivals beyond it are held.
+ * @param[in]  throttle          (bool) The source paused while a held
+ *                               arrival waited: it arrives when delivered,
+ *                               and every later arrival is pushed back by
+ *                               its wait
+ *
+ * @return     (int) The number of processes delivered.
+ */
+int ArrivalSource::deliverDue(long long now, ReadyQueue& readyQ, int room, bool throttle) {
+    int delivered = 0;
+
+    while ((next_ < arrivals_.size()) && (nextArrivalTime() <= now) &&
+           ((room < 0) || (delivered < room))) {
+        Process aProcess = workload_[arrivals_[next_].workloadIndex];
+        long long arrivalTime = nextArrivalTime();
+
+        if (next_ < heldEnd_) {
+            numHeld_++;
+            totalHoldMicros_ += now - arrivalTime;
+            maxHoldMicros_ = std::max(maxHoldMicros_, now - arrivalTime);
+
+            if (throttle) {
+                // the later arrivals were not made while the source paused,
+                // so none of them has been held yet
+                delayMicros_ += now - arrivalTime;
+                arrivalTime = now;
+                heldEnd_ = next_ + 1;
+            }
+        }
+
+        aProcess.setArrivalTime(arrivalTime);
+
+        // set process number
+        aProcess.setProcessNumber(readyQ.getProcessArrivalIndx());
+
+        // increment process arrival index in ready queue
+        readyQ.incrementProcessArrivalIndx();
+
+        // Add process to ready queue
+        readyQ.insertProcess(aProcess, arrivalTime);
+
+        next_++;
+        delivered++;
+    }
+
+    holdDue(now);
+
+    return delivered;
+}
+
+/**
+ * @brief      Drops every arrival that is due, for arrivals that found no
+ *             room.
+ *
+ * @param[in]  now   (long long) The current time in microseconds
+ *
+ * @return     (int) The number of arrivals dropped.
+ */
+int ArrivalSource::rejectDue(long long now) {
+    int rejected = 0;
+
+    while ((next_ < arrivals_.size()) && (nextArrivalTime() <= now)) {
+        next_++;
+        rejected++;
+    }
+
+    numRejected_ += rejected;
+
+    return rejected;
+}
+
+/**
+ * @brief      Marks every arrival that is due and not delivered as held, for
+ *             arrivals that found no room.
+ *
+ * @param[in]  now   (long long) The current time in microseconds
+ */
+void ArrivalSource::holdDue(long long now) {
+    heldEnd_ = std::max(heldEnd_, next_);
+
+    while ((heldEnd_ < arrivals_.size()) && ((arrivals_[heldEnd_].time + delayMicros_) <= now)) {
+        heldEnd_++;
+    }
+}
+
+long ArrivalSource::getNumHeld() const {
+    return numHeld_;
+}
+
+long ArrivalSource::getNumRejected() const {
+    return numRejected_;
+}
+
+/**
+ * @brief      Gets the mean time held arrivals waited for room.
+ *
+ * @return     (double) Microseconds, 0 if none were held.
+ */
+double ArrivalSource::getMeanHoldMicros() const {
+    return (numHeld_ > 0) ? ((double)totalHoldMicros_ / numHeld_) : 0;
+}
+
+long long ArrivalSource::getMaxHoldMicros() const {
+    return maxHoldMicros_;
+}
+
+/**
+ * @brief      Appends an arrival to the schedule.
+ *
+ * @param[in]  time           (long long) The arrival time in microseconds
+ * @param[in]  workloadIndex  (int) The index of the process in the workload
+ */
+void ArrivalSource::addArrival(long long time, int workloadIndex) {
+    Arrival anArrival;
+    anArrival.time = time;
+    anArrival.workloadIndex = workloadIndex;
+    arrivals_.push_back(anArrival);
+}
+
+/**
+ * @brief      Sorts the schedule by time. Arrivals at the same time keep
+ *             their workload order.
+ */
+void ArrivalSource::sortArrivals() {
+    std::stable_sort(arrivals_.begin(), arrivals_.end(),
+                     [](const Arrival& a, const Arrival& b) { return a.time < b.time; });
+}
+
+/**
+ * @brief      Writes the workload and the arrivals still to come to a
+ *             checkpoint, at their times after any throttling.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void ArrivalSource::save(CheckpointWriter& out) const {
+    out.putInt(workload_.size());
+    for (unsigned int i = 0; i < workload_.size(); i++) {
+        workload_[i].save(out);
+    }
+
+    out.putInt(arrivals_.size() - next_);
+    for (unsigned int i = next_; i < arrivals_.size(); i++) {
+        out.putInt(arrivals_[i].time + delayMicros_);
+        out.putInt(arrivals_[i].workloadIndex);
+    }
+
+    out.putInt(std::max(heldEnd_, next_) - next_);
+    out.putInt(numHeld_);
+    out.putInt(numRejected_);
+    out.putInt(totalHoldMicros_);
+    out.putInt(maxHoldMicros_);
+}
+
+/**
+ * @brief      Reads the workload and arrivals from a checkpoint.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void ArrivalSource::restore(CheckpointReader& in) {
+    workload_.assign(in.getInt(), Process());
+    for (unsigned int i = 0; i < workload_.size(); i++) {
+        workload_[i].restore(in);
+    }
+
+    arrivals_.resize(in.getInt());
+    for (unsigned int i = 0; i < arrivals_.size(); i++) {
+        arrivals_[i].time = in.getInt();
+        arrivals_[i].workloadIndex = in.getInt();
+
+        if ((arrivals_[i].workloadIndex < 0) || (arrivals_[i].workloadIndex >= (int)workload_.size())) {
+            // throw exception
+            throw std::logic_error("ArrivalSource Class: Checkpoint Arrival Has No Process");
+        }
+    }
+    next_ = 0;
+    delayMicros_ = 0;
+
+    heldEnd_ = in.getInt();
+    numHeld_ = in.getInt();
+    numRejected_ = in.getInt();
+    totalHoldMicros_ = in.getInt();
+    maxHoldMicros_ = in.getInt();
+}
+
+#endif
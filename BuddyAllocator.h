@@ -0,0 +1,500 @@
+/**
+ *  @file    BuddyAllocator.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _BUDDY_ALLOCATOR
+#define _BUDDY_ALLOCATOR
+
+#include <vector>
+#include <set>
+#include <map>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for a buddy-system allocator over the system memory.
+ *
+ * Memory is split into blocks whose sizes are a power of two times the
+ * minimum block size. A request is rounded up to the next such size, taken
+ * from the smallest free block that fits, and that block is split in halves
+ * until it is the right size. A freed block is merged with its buddy (the
+ * other half it was split from) whenever the buddy is also free. Sizes and
+ * addresses are in kbytes. Every allocation is owned by a process number so
+ * that a process's memory is released when it finishes.
+ */
+class BuddyAllocator
+{
+public:
+    // Default Constructor
+    BuddyAllocator() {
+        totalSize_ = 0;
+        minBlockSize_ = 1;
+        inUse_ = 0;
+        requested_ = 0;
+        peakInUse_ = 0;
+        peakInternal_ = 0;
+        numAllocations_ = 0;
+        numFrees_ = 0;
+        externalSamples_ = 0;
+        externalSum_ = 0;
+        externalMax_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(long totalSize, long minBlockSize);
+    long allocate(long size, int owner);
+    int freeOwner(int owner);
+    bool canEverFit(long size) const;
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    long getTotalSize() const;
+    long getInUse() const;
+    long getTotalFree() const;
+    long getLargestFree() const;
+    double getExternalFragmentation() const;
+    long getPeakInUse() const;
+    long getPeakInternalFragmentation() const;
+    long getNumAllocations() const;
+    long getNumFrees() const;
+    double getMeanExternalFragmentation() const;
+    double getMaxExternalFragmentation() const;
+
+private:
+    // Struct for an allocated block
+    struct Block {
+        int order;
+        int owner;
+        long requested;
+    };
+
+    // PRIVATE DATA
+    long totalSize_;
+    long minBlockSize_;
+    std::vector<std::set<long> > freeLists_; // free block addresses by order
+    std::map<long, Block> allocated_; // allocated blocks by address
+    std::unordered_map<int, std::vector<long> > owned_; // addresses by owner
+    long inUse_; // kbytes in allocated blocks
+    long requested_; // kbytes requested by the allocated blocks
+    long peakInUse_;
+    long peakInternal_;
+    long numAllocations_;
+    long numFrees_;
+    long externalSamples_;
+    double externalSum_;
+    double externalMax_;
+
+    // PRIVATE FUNCTIONS
+    int orderFor(long size) const;
+    long blockSize(int order) const;
+    void freeBlock(long address);
+    void sampleFragmentation();
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets up the free lists for the given memory size.
+ *
+ * If the total is not a power of two times the minimum block size it is
+ * covered by the largest aligned blocks that fit, which are never merged
+ * with each other.
+ *
+ * @param[in]  totalSize     (long) The system memory in kbytes
+ * @param[in]  minBlockSize  (long) The smallest block in kbytes
+ */
+void BuddyAllocator::initialize(long totalSize, long minBlockSize) {
+    if ((totalSize < 1) || (minBlockSize < 1)) {
+        // throw exception
+        throw std::logic_error("BuddyAllocator Class: Memory Size is Less Than One");
+    }
+
+    totalSize_ = totalSize;
+    minBlockSize_ = minBlockSize;
+    allocated_.clear();
+    owned_.clear();
+    inUse_ = 0;
+    requested_ = 0;
+
+    int maxOrder = 0;
+    while (blockSize(maxOrder + 1) <= totalSize_) {
+        maxOrder++;
+    }
+    freeLists_.assign(maxOrder + 1, std::set<long>());
+
+    // cover the memory with the largest aligned blocks
+    long address = 0;
+    while ((totalSize_ - address) >= minBlockSize_) {
+        int order = maxOrder;
+        while ((blockSize(order) > (totalSize_ - address)) || ((address % blockSize(order)) != 0)) {
+            order--;
+        }
+        freeLists_[order].insert(address);
+        address += blockSize(order);
+    }
+}
+
+/**
+ * @brief      Allocates a block for a process.
+ *
+ * @param[in]  size   (long) The requested size in kbytes
+ * @param[in]  owner  (int) The process number
+ *
+ * @return     (long) The address in kbytes, or -1 if no free block fits.
+ */
+long BuddyAllocator::allocate(long size, int owner) {
+    int order = orderFor(size);
+
+    if (order >= (int)freeLists_.size()) {
+        return -1;
+    }
+
+    // find the smallest free block that fits
+    int found = order;
+    while ((found < (int)freeLists_.size()) && freeLists_[found].empty()) {
+        found++;
+    }
+    if (found == (int)freeLists_.size()) {
+        sampleFragmentation();
+        return -1;
+    }
+
+    long address = *freeLists_[found].begin();
+    freeLists_[found].erase(freeLists_[found].begin());
+
+    // split until the block is the right size, freeing the upper halves
+    while (found > order) {
+        found--;
+        freeLists_[found].insert(address + blockSize(found));
+    }
+
+    Block aBlock;
+    aBlock.order = order;
+    aBlock.owner = owner;
+    aBlock.requested = size;
+    allocated_[address] = aBlock;
+    owned_[owner].push_back(address);
+
+    inUse_ += blockSize(order);
+    requested_ += size;
+    numAllocations_++;
+
+    if (inUse_ > peakInUse_) {
+        peakInUse_ = inUse_;
+    }
+    if ((inUse_ - requested_) > peakInternal_) {
+        peakInternal_ = inUse_ - requested_;
+    }
+
+    sampleFragmentation();
+
+    return address;
+}
+
+/**
+ * @brief      Frees every block owned by a process.
+ *
+ * @param[in]  owner  (int) The process number
+ *
+ * @return     (int) The number of blocks freed.
+ */
+int BuddyAllocator::freeOwner(int owner) {
+    std::unordered_map<int, std::vector<long> >::iterator ownerIter = owned_.find(owner);
+
+    if (ownerIter == owned_.end()) {
+        return 0;
+    }
+
+    int numFreed = ownerIter->second.size();
+
+    for (unsigned int i = 0; i < ownerIter->second.size(); i++) {
+        freeBlock(ownerIter->second[i]);
+    }
+    owned_.erase(ownerIter);
+
+    sampleFragmentation();
+
+    return numFreed;
+}
+
+/**
+ * @brief      Checks whether a request could be met if all memory were free.
+ *
+ * @param[in]  size  (long) The requested size in kbytes
+ *
+ * @return     true if the request fits in the largest block.
+ */
+bool BuddyAllocator::canEverFit(long size) const {
+    return orderFor(size) < (int)freeLists_.size();
+}
+
+/**
+ * @brief      Frees one block and merges it with its buddy while possible.
+ *
+ * @param[in]  address  (long) The address of the block in kbytes
+ */
+void BuddyAllocator::freeBlock(long address) {
+    std::map<long, Block>::iterator blockIter = allocated_.find(address);
+    int order = blockIter->second.order;
+
+    inUse_ -= blockSize(order);
+    requested_ -= blockIter->second.requested;
+    numFrees_++;
+    allocated_.erase(blockIter);
+
+    while (order < ((int)freeLists_.size() - 1)) {
+        // the buddy differs from the block only in the bit for its size
+        long buddy = ((address / minBlockSize_) ^ (1L << order)) * minBlockSize_;
+        std::set<long>::iterator buddyIter = freeLists_[order].find(buddy);
+
+        if (buddyIter == freeLists_[order].end()) {
+            break;
+        }
+
+        freeLists_[order].erase(buddyIter);
+        if (buddy < address) {
+            address = buddy;
+        }
+        order++;
+    }
+
+    freeLists_[order].insert(address);
+}
+
+/**
+ * @brief      Records the current external fragmentation for the statistics.
+ */
+void BuddyAllocator::sampleFragmentation() {
+    double external = getExternalFragmentation();
+
+    externalSamples_++;
+    externalSum_ += external;
+    if (external > externalMax_) {
+        externalMax_ = external;
+    }
+}
+
+/**
+ * @brief      Gets the smallest order whose block holds the size.
+ *
+ * @param[in]  size  (long) The size in kbytes
+ *
+ * @return     (int) The order.
+ */
+int BuddyAllocator::orderFor(long size) const {
+    int order = 0;
+
+    while (blockSize(order) < size) {
+        order++;
+    }
+
+    return order;
+}
+
+/**
+ * @brief      Gets the size of a block of the given order.
+ *
+ * @param[in]  order  (int) The order
+ *
+ * @return     (long) The size in kbytes.
+ */
+long BuddyAllocator::blockSize(int order) const {
+    return minBlockSize_ << order;
+}
+
+long BuddyAllocator::getTotalSize() const {
+    return totalSize_;
+}
+
+long BuddyAllocator::getInUse() const {
+    return inUse_;
+}
+
+/**
+ * @brief      Gets the free memory, not counting any remainder smaller than
+ *             the minimum block.
+ *
+ * @return     (long) The free memory in kbytes.
+ */
+long BuddyAllocator::getTotalFree() const {
+    long totalFree = 0;
+
+    for (unsigned int order = 0; order < freeLists_.size(); order++) {
+        totalFree += freeLists_[order].size() * blockSize(order);
+    }
+
+    return totalFree;
+}
+
+/**
+ * @brief      Gets the largest free block.
+ *
+ * @return     (long) The size in kbytes, 0 if memory is full.
+ */
+long BuddyAllocator::getLargestFree() const {
+    for (int order = freeLists_.size() - 1; order >= 0; order--) {
+        if (!freeLists_[order].empty()) {
+            return blockSize(order);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      Gets the external fragmentation, the share of free memory that
+ *             is not in the largest free block.
+ *
+ * @return     (double) 0 (unfragmented) to 1.
+ */
+double BuddyAllocator::getExternalFragmentation() const {
+    long totalFree = getTotalFree();
+
+    if (totalFree == 0) {
+        return 0;
+    }
+
+    return 1.0 - ((double)getLargestFree() / totalFree);
+}
+
+long BuddyAllocator::getPeakInUse() const {
+    return peakInUse_;
+}
+
+/**
+ * @brief      Gets the most memory lost to rounding requests up to block sizes.
+ *
+ * @return     (long) The peak internal fragmentation in kbytes.
+ */
+long BuddyAllocator::getPeakInternalFragmentation() const {
+    return peakInternal_;
+}
+
+long BuddyAllocator::getNumAllocations() const {
+    return numAllocations_;
+}
+
+long BuddyAllocator::getNumFrees() const {
+    return numFrees_;
+}
+
+/**
+ * @brief      Gets the mean external fragmentation over every allocation,
+ *             failed allocation and release.
+ *
+ * @return     (double) 0 to 1.
+ */
+double BuddyAllocator::getMeanExternalFragmentation() const {
+    if (externalSamples_ == 0) {
+        return 0;
+    }
+
+    return externalSum_ / externalSamples_;
+}
+
+double BuddyAllocator::getMaxExternalFragmentation() const {
+    return externalMax_;
+}
+
+/**
+ * @brief      Writes the free lists, the allocated blocks and the statistics
+ *             to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void BuddyAllocator::save(CheckpointWriter& out) const {
+    out.putInt(totalSize_);
+    out.putInt(minBlockSize_);
+
+    out.putInt(freeLists_.size());
+    for (unsigned int order = 0; order < freeLists_.size(); order++) {
+        out.putInt(freeLists_[order].size());
+        for (std::set<long>::const_iterator it = freeLists_[order].begin(); it != freeLists_[order].end(); ++it) {
+            out.putInt(*it);
+        }
+    }
+
+    out.putInt(allocated_.size());
+    for (std::map<long, Block>::const_iterator it = allocated_.begin(); it != allocated_.end(); ++it) {
+        out.putInt(it->first);
+        out.putInt(it->second.order);
+        out.putInt(it->second.owner);
+        out.putInt(it->second.requested);
+    }
+
+    out.putInt(owned_.size());
+    for (std::unordered_map<int, std::vector<long> >::const_iterator it = owned_.begin(); it != owned_.end(); ++it) {
+        out.putInt(it->first);
+        out.putInt(it->second.size());
+        for (unsigned int i = 0; i < it->second.size(); i++) {
+            out.putInt(it->second[i]);
+        }
+    }
+
+    out.putInt(inUse_);
+    out.putInt(requested_);
+    out.putInt(peakInUse_);
+    out.putInt(peakInternal_);
+    out.putInt(numAllocations_);
+    out.putInt(numFrees_);
+    out.putInt(externalSamples_);
+    out.putDouble(externalSum_);
+    out.putDouble(externalMax_);
+}
+
+/**
+ * @brief      Reads the allocator from a checkpoint, replacing its state.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void BuddyAllocator::restore(CheckpointReader& in) {
+    totalSize_ = in.getInt();
+    minBlockSize_ = in.getInt();
+
+    freeLists_.assign(in.getInt(), std::set<long>());
+    for (unsigned int order = 0; order < freeLists_.size(); order++) {
+        for (long long i = in.getInt(); i > 0; i--) {
+            freeLists_[order].insert(in.getInt());
+        }
+    }
+
+    allocated_.clear();
+    for (long long i = in.getInt(); i > 0; i--) {
+        long address = in.getInt();
+        Block aBlock;
+        aBlock.order = in.getInt();
+        aBlock.owner = in.getInt();
+        aBlock.requested = in.getInt();
+        allocated_[address] = aBlock;
+    }
+
+    owned_.clear();
+    for (long long i = in.getInt(); i > 0; i--) {
+        std::vector<long>& addresses = owned_[in.getInt()];
+        for (long long j = in.getInt(); j > 0; j--) {
+            addresses.push_back(in.getInt());
+        }
+    }
+
+    inUse_ = in.getInt();
+    requested_ = in.getInt();
+    peakInUse_ = in.getInt();
+    peakInternal_ = in.getInt();
+    numAllocations_ = in.getInt();
+    numFrees_ = in.getInt();
+    externalSamples_ = in.getInt();
+    externalSum_ = in.getDouble();
+    externalMax_ = in.getDouble();
+}
+
+#endif
@@ -0,0 +1,319 @@
+/**
+ *  @file    CacheHierarchy.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _CACHE_HIERARCHY
+#define _CACHE_HIERARCHY
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Struct for one level of the CPU cache, from a Cache level
+ *             command.
+ */
+struct CacheLevelSpec {
+    std::string name; // e.g. "L1"
+    int size; // kbytes
+    int ways; // lines per set
+    int hitTime; // nanoseconds to hit in this level
+};
+
+/**
+ * @brief      Class for a hierarchy of set-associative CPU caches, from the
+ *             level nearest the CPU to the last level cache.
+ *
+ * An access looks in each level in turn and takes the hit time of the first
+ * level holding the line, or the memory access time if none does. The line
+ * is then filled into every level that missed, evicting the least recently
+ * used line of its set. Lines are tagged with the process that owns them,
+ * so processes sharing the CPU evict each other's working sets, and those
+ * evictions are counted per level.
+ */
+class CacheHierarchy
+{
+public:
+    // Default Constructor
+    CacheHierarchy() {
+        lineSize_ = 64;
+        memoryTime_ = 0;
+        useCounter_ = 0;
+        memoryAccesses_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(const std::vector<CacheLevelSpec>& levels, int lineSize, int memoryTime);
+    int access(int owner, long long line);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    bool isEnabled() const;
+    int getLineSize() const;
+    int getNumLevels() const;
+    std::string getLevelName(int level) const;
+    int getHitTime(int level) const;
+    long getHits(int level) const;
+    long getMisses(int level) const;
+    long getForeignEvictions(int level) const;
+    long getMemoryAccesses() const;
+
+private:
+    // Struct for one level of the hierarchy
+    struct Level {
+        CacheLevelSpec spec;
+        int numSets;
+        std::vector<uint64_t> tags; // set * ways + way, 0 if empty
+        std::vector<long long> lastUse; // for LRU
+        long hits;
+        long misses;
+        long foreignEvictions; // lines of another process evicted
+    };
+
+    // PRIVATE DATA
+    std::vector<Level> levels_;
+    int lineSize_; // bytes
+    int memoryTime_; // nanoseconds to miss every level
+    long long useCounter_; // logical time of accesses
+    long memoryAccesses_;
+
+    // PRIVATE FUNCTIONS
+    bool lookup(Level& aLevel, uint64_t tag);
+    void fill(Level& aLevel, uint64_t tag);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets up the empty levels.
+ *
+ * @param[in]  levels      (const std::vector<CacheLevelSpec>&) The levels,
+ *                         nearest the CPU first
+ * @param[in]  lineSize    (int) Bytes per line
+ * @param[in]  memoryTime  (int) Nanoseconds for an access that misses every level
+ */
+void CacheHierarchy::initialize(const std::vector<CacheLevelSpec>& levels, int lineSize, int memoryTime) {
+    if (lineSize < 1) {
+        // throw exception
+        throw std::logic_error("CacheHierarchy Class: Cache Line Size is Less Than One");
+    }
+
+    lineSize_ = lineSize;
+    memoryTime_ = memoryTime;
+    useCounter_ = 0;
+    memoryAccesses_ = 0;
+    levels_.clear();
+
+    for (unsigned int i = 0; i < levels.size(); i++) {
+        Level aLevel;
+        long long numLines = levels[i].size * 1024LL / lineSize_;
+
+        aLevel.spec = levels[i];
+        aLevel.numSets = (levels[i].ways > 0) ? (int)(numLines / levels[i].ways) : 0;
+
+        if (aLevel.numSets < 1) {
+            // throw exception
+            throw std::logic_error("CacheHierarchy Class: Cache Level " + levels[i].name +
+                                   " Is Smaller Than One Set");
+        }
+
+        aLevel.tags.assign(aLevel.numSets * levels[i].ways, 0);
+        aLevel.lastUse.assign(aLevel.tags.size(), 0);
+        aLevel.hits = 0;
+        aLevel.misses = 0;
+        aLevel.foreignEvictions = 0;
+
+        levels_.push_back(aLevel);
+    }
+}
+
+/**
+ * @brief      Accesses a line of a process's working set.
+ *
+ * @param[in]  owner  (int) The process number
+ * @param[in]  line   (long long) The line within the working set
+ *
+ * @return     (int) The nanoseconds the access took.
+ */
+int CacheHierarchy::access(int owner, long long line) {
+    // tag 0 marks an empty way, so the owner is stored plus one
+    uint64_t tag = ((uint64_t)(owner + 1) << 40) | (uint64_t)line;
+    unsigned int hitLevel = 0;
+
+    useCounter_++;
+
+    while ((hitLevel < levels_.size()) && (!lookup(levels_[hitLevel], tag))) {
+        hitLevel++;
+    }
+
+    for (unsigned int i = 0; i < hitLevel; i++) {
+        fill(levels_[i], tag);
+    }
+
+    if (hitLevel == levels_.size()) {
+        memoryAccesses_++;
+        return memoryTime_;
+    }
+
+    return levels_[hitLevel].spec.hitTime;
+}
+
+/**
+ * @brief      Looks for a line in one level, counting the hit or miss.
+ *
+ * @param      aLevel  (Level&) The level
+ * @param[in]  tag     (uint64_t) The owner and line
+ *
+ * @return     (bool) True if the level holds the line.
+ */
+bool CacheHierarchy::lookup(Level& aLevel, uint64_t tag) {
+    int ways = aLevel.spec.ways;
+    int base = (int)(tag % aLevel.numSets) * ways;
+
+    for (int way = 0; way < ways; way++) {
+        if (aLevel.tags[base + way] == tag) {
+            aLevel.lastUse[base + way] = useCounter_;
+            aLevel.hits++;
+            return true;
+        }
+    }
+
+    aLevel.misses++;
+    return false;
+}
+
+/**
+ * @brief      Puts a line in one level in place of the least recently used
+ *             line of its set.
+ *
+ * @param      aLevel  (Level&) The level
+ * @param[in]  tag     (uint64_t) The owner and line
+ */
+void CacheHierarchy::fill(Level& aLevel, uint64_t tag) {
+    int ways = aLevel.spec.ways;
+    int base = (int)(tag % aLevel.numSets) * ways;
+    int victim = base;
+
+    for (int way = 1; way < ways; way++) {
+        if (aLevel.lastUse[base + way] < aLevel.lastUse[victim]) {
+            victim = base + way;
+        }
+    }
+
+    if ((aLevel.tags[victim] != 0) && ((aLevel.tags[victim] >> 40) != (tag >> 40))) {
+        aLevel.foreignEvictions++;
+    }
+
+    aLevel.tags[victim] = tag;
+    aLevel.lastUse[victim] = useCounter_;
+}
+
+bool CacheHierarchy::isEnabled() const {
+    return !levels_.empty();
+}
+
+int CacheHierarchy::getLineSize() const {
+    return lineSize_;
+}
+
+int CacheHierarchy::getNumLevels() const {
+    return levels_.size();
+}
+
+std::string CacheHierarchy::getLevelName(int level) const {
+    return levels_[level].spec.name;
+}
+
+int CacheHierarchy::getHitTime(int level) const {
+    return levels_[level].spec.hitTime;
+}
+
+long CacheHierarchy::getHits(int level) const {
+    return levels_[level].hits;
+}
+
+long CacheHierarchy::getMisses(int level) const {
+    return levels_[level].misses;
+}
+
+long CacheHierarchy::getForeignEvictions(int level) const {
+    return levels_[level].foreignEvictions;
+}
+
+long CacheHierarchy::getMemoryAccesses() const {
+    return memoryAccesses_;
+}
+
+/**
+ * @brief      Writes the contents and counters of every level to a
+ *             checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void CacheHierarchy::save(CheckpointWriter& out) const {
+    out.putInt(useCounter_);
+    out.putInt(memoryAccesses_);
+
+    out.putInt(levels_.size());
+    for (unsigned int i = 0; i < levels_.size(); i++) {
+        const Level& aLevel = levels_[i];
+
+        out.putInt(aLevel.tags.size());
+        for (unsigned int j = 0; j < aLevel.tags.size(); j++) {
+            out.putInt(aLevel.tags[j]);
+            out.putInt(aLevel.lastUse[j]);
+        }
+
+        out.putInt(aLevel.hits);
+        out.putInt(aLevel.misses);
+        out.putInt(aLevel.foreignEvictions);
+    }
+}
+
+/**
+ * @brief      Reads the contents and counters of every level from a
+ *             checkpoint. The levels are those of the configuration, and
+ *             must match the ones saved.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void CacheHierarchy::restore(CheckpointReader& in) {
+    useCounter_ = in.getInt();
+    memoryAccesses_ = in.getInt();
+
+    if (in.getInt() != (long long)levels_.size()) {
+        // throw exception
+        throw std::logic_error("CacheHierarchy Class: Checkpoint Cache Levels Do Not Match");
+    }
+
+    for (unsigned int i = 0; i < levels_.size(); i++) {
+        Level& aLevel = levels_[i];
+
+        if (in.getInt() != (long long)aLevel.tags.size()) {
+            // throw exception
+            throw std::logic_error("CacheHierarchy Class: Checkpoint Cache Levels Do Not Match");
+        }
+
+        for (unsigned int j = 0; j < aLevel.tags.size(); j++) {
+            aLevel.tags[j] = in.getInt();
+            aLevel.lastUse[j] = in.getInt();
+        }
+
+        aLevel.hits = in.getInt();
+        aLevel.misses = in.getInt();
+        aLevel.foreignEvictions = in.getInt();
+    }
+}
+
+#endif
@@ -0,0 +1,295 @@
+/**
+ *  @file    Checkpoint.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _CHECKPOINT
+#define _CHECKPOINT
+
+#include <string>
+#include <fstream>
+#include <vector>
+#include <map>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+// Start of every checkpoint file
+const char CHECKPOINT_MAGIC[] = "OSSIMCKP";
+// Bumped whenever the layout of the saved state changes
+const int CHECKPOINT_VERSION = 9;
+
+
+/**
+ * @brief      Class for writing a checkpoint file.
+ *
+ * The file is the magic string and version followed by the values in the
+ * order the classes save them. Integers are zigzag varints, so the small
+ * numbers that make up most of the state take one or two bytes. Doubles are
+ * their 8 bytes, least significant first. Strings are a length and their
+ * bytes. An object with several owners is written once, where it first
+ * appears, and every owner writes its index.
+ */
+class CheckpointWriter
+{
+public:
+    // OVERLOADED CONSTRUCTOR
+    explicit CheckpointWriter(std::string filePath);
+
+    // PUBLIC FUNCTIONS
+    void putInt(long long value);
+    void putDouble(double value);
+    void putBool(bool value);
+    void putString(const std::string& value);
+    bool putShared(const void* object);
+    void close();
+
+private:
+    // PRIVATE DATA
+    std::ofstream out_;
+    std::map<const void*, int> shared_; // index of every shared object written
+};
+
+/**
+ * @brief      Class for reading a checkpoint file written by
+ *             CheckpointWriter. Every get throws if the file ends early.
+ */
+class CheckpointReader
+{
+public:
+    // OVERLOADED CONSTRUCTOR
+    explicit CheckpointReader(std::string filePath);
+
+    // PUBLIC FUNCTIONS
+    long long getInt();
+    double getDouble();
+    bool getBool();
+    std::string getString();
+    template <class T> bool getShared(std::shared_ptr<T>& object);
+
+private:
+    // PRIVATE DATA
+    std::ifstream in_;
+    std::vector<std::shared_ptr<void> > shared_; // shared objects by index
+
+    // PRIVATE FUNCTIONS
+    unsigned char getByte();
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Creates the file and writes its header.
+ *
+ * @param[in]  filePath  (std::string) The checkpoint file path
+ */
+CheckpointWriter::CheckpointWriter(std::string filePath)
+    : out_(filePath.c_str(), std::ios::binary | std::ios::trunc) {
+    if (out_.fail()) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Cannot Create Checkpoint File");
+    }
+
+    out_.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) - 1);
+    putInt(CHECKPOINT_VERSION);
+}
+
+void CheckpointWriter::putInt(long long value) {
+    // zigzag: small negative numbers are small too
+    uint64_t bits = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+
+    while (bits >= 0x80) {
+        out_.put((char)((bits & 0x7f) | 0x80));
+        bits >>= 7;
+    }
+    out_.put((char)bits);
+}
+
+void CheckpointWriter::putDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    for (int i = 0; i < 8; i++) {
+        out_.put((char)(bits >> (8 * i)));
+    }
+}
+
+void CheckpointWriter::putBool(bool value) {
+    out_.put(value ? 1 : 0);
+}
+
+void CheckpointWriter::putString(const std::string& value) {
+    putInt(value.size());
+    out_.write(value.data(), value.size());
+}
+
+/**
+ * @brief      Writes the index of an object that several owners share.
+ *
+ * @param[in]  object  (const void*) The object, NULL for none
+ *
+ * @return     true if this is the object's first appearance, so the caller
+ *             must write the object after its index.
+ */
+bool CheckpointWriter::putShared(const void* object) {
+    if (object == NULL) {
+        putInt(-1);
+        return false;
+    }
+
+    std::map<const void*, int>::iterator it = shared_.find(object);
+    if (it != shared_.end()) {
+        putInt(it->second);
+        return false;
+    }
+
+    int index = shared_.size();
+    shared_[object] = index;
+    putInt(index);
+
+    return true;
+}
+
+/**
+ * @brief      Closes the file, checking that every value was written.
+ */
+void CheckpointWriter::close() {
+    out_.close();
+
+    if (out_.fail()) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Cannot Write Checkpoint File");
+    }
+}
+
+/**
+ * @brief      Opens the file and checks its header.
+ *
+ * @param[in]  filePath  (std::string) The checkpoint file path
+ */
+CheckpointReader::CheckpointReader(std::string filePath)
+    : in_(filePath.c_str(), std::ios::binary) {
+    if (in_.fail()) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Incorrect Checkpoint File Path");
+    }
+
+    char magic[sizeof(CHECKPOINT_MAGIC) - 1];
+    in_.read(magic, sizeof(magic));
+
+    if (in_.fail() || (std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0)) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Not A Checkpoint File");
+    }
+
+    if (getInt() != CHECKPOINT_VERSION) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Unsupported Checkpoint Version");
+    }
+}
+
+unsigned char CheckpointReader::getByte() {
+    int aByte = in_.get();
+
+    if (aByte == std::char_traits<char>::eof()) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Checkpoint File Is Truncated");
+    }
+
+    return (unsigned char)aByte;
+}
+
+long long CheckpointReader::getInt() {
+    uint64_t bits = 0;
+    unsigned char aByte;
+
+    for (int shift = 0; ; shift += 7) {
+        if (shift > 63) {
+            // throw exception
+            throw std::logic_error("Checkpoint Class: Checkpoint File Is Corrupt");
+        }
+
+        aByte = getByte();
+        bits |= (uint64_t)(aByte & 0x7f) << shift;
+
+        if (!(aByte & 0x80)) {
+            break;
+        }
+    }
+
+    return (long long)(bits >> 1) ^ -(long long)(bits & 1);
+}
+
+double CheckpointReader::getDouble() {
+    uint64_t bits = 0;
+
+    for (int i = 0; i < 8; i++) {
+        bits |= (uint64_t)getByte() << (8 * i);
+    }
+
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+bool CheckpointReader::getBool() {
+    return getByte() != 0;
+}
+
+std::string CheckpointReader::getString() {
+    long long length = getInt();
+
+    if (length < 0) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Checkpoint File Is Corrupt");
+    }
+
+    std::string value;
+    for (long long i = 0; i < length; i++) {
+        value += (char)getByte();
+    }
+
+    return value;
+}
+
+/**
+ * @brief      Reads an object written by CheckpointWriter::putShared, so
+ *             that its owners share it again.
+ *
+ * @param      object  (std::shared_ptr<T>&) Set to the object, to a new
+ *                     empty object on its first appearance, or to NULL
+ *
+ * @return     true if this is the object's first appearance, so the caller
+ *             must read the object into the new one.
+ */
+template <class T>
+bool CheckpointReader::getShared(std::shared_ptr<T>& object) {
+    long long index = getInt();
+
+    if (index == -1) {
+        object.reset();
+        return false;
+    }
+    if (index == (long long)shared_.size()) {
+        object.reset(new T());
+        shared_.push_back(object);
+        return true;
+    }
+    if ((index < 0) || (index > (long long)shared_.size())) {
+        // throw exception
+        throw std::logic_error("Checkpoint Class: Checkpoint File Is Corrupt");
+    }
+
+    object = std::static_pointer_cast<T>(shared_[index]);
+
+    return false;
+}
+
+#endif
@@ -12,24 +12,32 @@
 #include <string>
 #include <fstream>
 #include <unordered_map>
+#include <vector>
 #include <regex>
 #include <stdexcept>
 
 #include "CycleTime.h"
+#include "DeviceRegistry.h"
+#include "CacheHierarchy.h"
+#include "PhaseProfiler.h"
 
 /**
  * @brief      Global enum values used for encoding and interpreting a command
  *             string from the configuration file.
  */
-enum Command {VERSION, MDF, PROJECTOR, PROCESSOR, KEYBOARD, 
-              MONITOR, SCANNER, HARD_DRIVE, LOG, LOG_FILE, 
-              MEMORY, SYSMEMORY, BLOCK_SIZE, RESOURCE, PQN, 
-              SCHED_CODE, UNKNOWN};
-
-/**
- * @brief      Glogal constant for the number of I/O resources
- */
-const int NUM_IO_RESOURCES = 5;
+enum Command {VERSION, MDF, PROCESSOR, DEVICE_TIME, LOG, LOG_FILE, 
+              MEMORY, SYSMEMORY, BLOCK_SIZE, RESOURCE, DEVICE, PQN, 
+              SCHED_CODE, CLOCK, ARRIVAL_MODE, ARRIVAL_FILE, 
+              ARRIVAL_RATE, ARRIVAL_COUNT, ARRIVAL_SEED, 
+              RELOAD_COUNT, RELOAD_INTERVAL, MEMORY_MODE, 
+              PAGE_POLICY, TLB_ENTRIES, DISK_POLICY, DISK_TRACKS, 
+              SEEK_PER_TRACK, SEEK_SETTLE, DEVICE_BATCH, REPLAY_SEED, 
+              SERVICE_JITTER, CHECKPOINT_TIME, CHECKPOINT_FILE, 
+              RESTORE_FILE, CONTEXT_SWITCH, CACHE_REFILL, 
+              CACHE_WARM, CACHE_LEVEL, CACHE_LINE, MEMORY_ACCESS, 
+              CACHE_ACCESSES, STR_AGING, ADMISSION_LIMIT, 
+              ADMISSION_POLICY, METRICS_INTERVAL, METRICS_FILE, 
+              METRICS_FORMAT, UNKNOWN};
 
 /**
  * @brief      Class for parsing the configuration file, storing its 
@@ -45,16 +53,96 @@ public:
     int getLogFileMethod() const;
     int getSystemMemory() const;
     int getBlockSize() const;
-    // Indices: 0=hard drive, 1=keyboard, 2=scanner, 3=monitor, 4=projector
-    int getResourceSize(int resourceIndex) const;
-    // keys are: projector, processor, keyboard, monitor, scanner, hardDrive
+    const DeviceRegistry& getDevices() const;
+    // keys are: processor, memory
     CycleTime getCycleTime(std::string key);
-    // 0 for RR, 1 for STR
+    // 0 for RR, 1 for STR, 2 for EDF
     int getSchedCode() const;
     int getPQN() const;
+    int getSTRAging() const;
+    // 0 for real time, 1 for virtual time
+    int getClockMode() const;
+    // 0 for reload, 1 for schedule, 2 for poisson
+    int getArrivalMode() const;
+    std::string getArrivalFilePath() const;
+    double getArrivalRate() const;
+    int getArrivalCount() const;
+    unsigned long long getArrivalSeed() const;
+    int getReloadCount() const;
+    int getReloadInterval() const;
+    // 0 for buddy, 1 for paged
+    int getMemoryMode() const;
+    // 0 for FIFO, 1 for LRU, 2 for CLOCK
+    int getPagePolicy() const;
+    int getTLBEntries() const;
+    // -1 for off, 0 for FCFS, 1 for SSTF, 2 for SCAN, 3 for C-LOOK
+    int getDiskPolicy() const;
+    int getDiskTracks() const;
+    int getSeekPerTrack() const;
+    int getSeekSettle() const;
+    // -1 for off
+    long long getReplaySeed() const;
+    int getServiceJitter() const;
+    // -1 for no checkpoint
+    int getCheckpointTime() const;
+    std::string getCheckpointFilePath() const;
+    // empty to start from the meta data file
+    std::string getRestoreFilePath() const;
+    int getContextSwitchTime() const;
+    int getCacheRefillTime() const;
+    int getCacheWarmTime() const;
+    // empty for no cache hierarchy
+    const std::vector<CacheLevelSpec>& getCacheLevels() const;
+    int getCacheLineSize() const;
+    int getMemoryAccessTime() const;
+    int getCacheAccesses() const;
+    // 0 for no limit
+    int getAdmissionLimit() const;
+    // 0 for queue, 1 for reject, 2 for throttle
+    int getAdmissionPolicy() const;
+    // 0 for no metrics
+    int getMetricsInterval() const;
+    std::string getMetricsFilePath() const;
+    // 0 for CSV, 1 for Prometheus
+    int getMetricsFormat() const;
 
     // PUBLIC FUNCTIONS
     void parseConfigFile(std::string configFile);
+    void setCommand(std::string command, std::string value);
+
+    // Default Constructor
+    Configuration() {
+        clockMode_ = 0;
+        arrivalMode_ = 0;
+        arrivalRate_ = 10;
+        arrivalCount_ = 0;
+        arrivalSeed_ = 1;
+        reloadCount_ = 10;
+        reloadInterval_ = 100;
+        memoryMode_ = 0;
+        pagePolicy_ = 0;
+        tlbEntries_ = 8;
+        diskPolicy_ = -1;
+        diskTracks_ = 200;
+        seekPerTrack_ = 100;
+        seekSettle_ = 1000;
+        replaySeed_ = -1;
+        serviceJitter_ = 0;
+        checkpointTime_ = -1;
+        checkpointFilePath_ = "checkpoint.ckp";
+        contextSwitchTime_ = 0;
+        cacheRefillTime_ = 0;
+        cacheWarmTime_ = 0;
+        cacheLineSize_ = 64;
+        memoryAccessTime_ = 100;
+        cacheAccesses_ = 1000;
+        strAging_ = 0;
+        admissionLimit_ = 0;
+        admissionPolicy_ = 0;
+        metricsInterval_ = 0;
+        metricsFilePath_ = "metrics.csv";
+        metricsFormat_ = 0;
+    }
 
 private:
     // PRIVATE DATA
@@ -63,24 +151,63 @@ private:
     std::string logFilePath_;
     // 0 for monitor, 1 for logfile, 2 for both
     int logFileMethod_;
-    // 0 for RR, 1 for STR
+    // 0 for RR, 1 for STR, 2 for EDF
     int schedCode_;
     int systemMemory_;
     int blockSize_;
     int pqn_;
+    int strAging_; // percent of the time waited taken off STR's time remaining
+    // 0 for real time, 1 for virtual time
+    int clockMode_;
+    // 0 for reload, 1 for schedule, 2 for poisson
+    int arrivalMode_;
+    std::string arrivalFilePath_;
+    double arrivalRate_; // poisson arrivals per second
+    int arrivalCount_; // poisson arrivals, 0 for one per process in the mdf
+    unsigned long long arrivalSeed_;
+    int reloadCount_; // reloads of the mdf after the first load
+    int reloadInterval_; // milliseconds between reloads
+    // 0 for buddy, 1 for paged
+    int memoryMode_;
+    // 0 for FIFO, 1 for LRU, 2 for CLOCK
+    int pagePolicy_;
+    int tlbEntries_;
+    // -1 for off, 0 for FCFS, 1 for SSTF, 2 for SCAN, 3 for C-LOOK
+    int diskPolicy_;
+    int diskTracks_;
+    int seekPerTrack_; // microseconds per track crossed
+    int seekSettle_; // microseconds for any seek
+    long long replaySeed_; // seed of every random choice, -1 for off
+    int serviceJitter_; // percent that service times vary by
+    int checkpointTime_; // milliseconds, -1 for no checkpoint
+    std::string checkpointFilePath_;
+    std::string restoreFilePath_; // empty to start from the meta data file
+    int contextSwitchTime_; // microseconds for every switch between processes
+    int cacheRefillTime_; // microseconds to refill a cold cache
+    int cacheWarmTime_; // milliseconds of other processes' CPU time that cool a cache
+    std::vector<CacheLevelSpec> cacheLevels_; // nearest the CPU first
+    int cacheLineSize_; // bytes
+    int memoryAccessTime_; // nanoseconds for an access that misses every cache level
+    int cacheAccesses_; // working set accesses per processing cycle
+    int admissionLimit_; // processes admitted and not finished, 0 for no limit
+    // 0 for queue, 1 for reject, 2 for throttle
+    int admissionPolicy_;
+    int metricsInterval_; // milliseconds between samples, 0 for no metrics
+    std::string metricsFilePath_;
+    // 0 for CSV, 1 for Prometheus
+    int metricsFormat_;
     // unordered_map using keys store/access CycleTime objects
-    // keys are: projector, processor, keyboard, monitor, scanner, hardDrive
+    // keys are: processor, memory
     std::unordered_map<std::string, CycleTime> timeMap_;
-    // Array for holding I/O process resources
-    // Indices: 0=hard drive, 1=keyboard, 2=scanner, 3=monitor, 4=projector
-    int ioResources_[NUM_IO_RESOURCES];
+    // I/O devices, from the Device command or the legacy device keys
+    DeviceRegistry devices_;
 
     // PRIVATE FUNCTIONS
     void parseCommandString(std::string cmdString);
     Command ClassifyCmd(std::string command, 
                         int& bytesSysMem, 
                         int& bytesBlockSize, 
-                        int& resourceIndex);
+                        int& deviceIndex);
     
     // PRIVATE COMMAND HANDLER FUNCTIONS
     void handleVersion(std::string value);
@@ -89,10 +216,21 @@ private:
     void handleLogFile(std::string value);
     void handleSystemMemory(std::string value, int bytesSysMem);
     void handleBlockSize(std::string value, int bytesBlockSize);
-    void handleResource(std::string value, int resourceIndex);
+    void handleResource(std::string value, int deviceIndex);
+    void handleDeviceTime(std::string value, int deviceIndex);
     void handleTime(std::string value, Command cmd);
     void handlePQN(std::string value);
     void handleSchedCode(std::string value);
+    void handleClock(std::string value);
+    void handleArrivalMode(std::string value);
+    void handleArrivalRate(std::string value);
+    void handleMemoryMode(std::string value);
+    void handlePagePolicy(std::string value);
+    void handleDiskPolicy(std::string value);
+    void handleCacheLevel(std::string value);
+    void handleAdmissionPolicy(std::string value);
+    void handleMetricsFormat(std::string value);
+    void handleCount(std::string value, Command cmd);
 };
 
 //******************************************************************************
@@ -106,6 +244,8 @@ private:
  * @param[in]  configFile  (std::string) The configuration file path
  */
 void Configuration::parseConfigFile(std::string configFile) {
+    ScopedPhaseTimer timer("Parse configuration");
+
     std::ifstream inputFile(configFile.c_str());
 
     if (inputFile.fail()) {
@@ -119,11 +259,6 @@ void Configuration::parseConfigFile(std::string configFile) {
     // holds full line from file
     std::string cmdString;
 
-    // Initialize I/O resources to 1
-    for (int i = 0; i < NUM_IO_RESOURCES; i++) {
-        ioResources_[i] = 1;
-    }
-
     // Priming Read (to avoid errors)
     std::getline(inputFile, cmdString);
 
@@ -136,6 +271,17 @@ void Configuration::parseConfigFile(std::string configFile) {
     inputFile.close();
 }
 
+/**
+ * @brief      Sets one command as if it were a line of the configuration
+ *             file, overriding the value read from the file.
+ *
+ * @param[in]  command  (std::string) The command, e.g. "Quantum Number {msec}"
+ * @param[in]  value    (std::string) The value, e.g. "20"
+ */
+void Configuration::setCommand(std::string command, std::string value) {
+    parseCommandString(command + ": " + value);
+}
+
 /**
  * @brief      Uses regular expressions to parse the full line for valid command 
  * 			   information. The information in the command is classified by 
@@ -167,14 +313,15 @@ void Configuration::parseCommandString(std::string cmdString) {
     			the forst sub_match
     		[\\s]* means zero or more whitespaces are ignored
     		: is a required delimiter
-    		([\\w\\.\\s]+.) means one or more alpha-numeric characters, underscores,
-				periods, (see next line for .) are stored in second sub_match
+    		([\\w\\.\\s,\\-]+.) means one or more alpha-numeric characters, underscores,
+				periods, whitespaces, commas, dashes (see next line for .) are stored
+				in second sub_match
 		**note:
 			I had to add the . at the end of the sub_match to avoid the sub_match
 			from collecting a trailing carriage-return (ASCII code 13)
 			The . means any character except a line-terminator
     */
-    std::regex cmdStringRE("^[\\s]*([\\w\\{\\}/\\s]+)[\\s]*:[\\s]*([\\w\\.\\s]+.)[\\s]*$");
+    std::regex cmdStringRE("^[\\s]*([\\w\\{\\}/\\s]+)[\\s]*:[\\s]*([\\w\\.\\s,\\-]+.)[\\s]*$");
     std::smatch collectedInfo;
     // collectedInfo holds information collected by regex_match about items
     // in the parenthesis (submatches)
@@ -183,10 +330,10 @@ void Configuration::parseCommandString(std::string cmdString) {
     // integer reference for kB=1, MB=2, or GB=3. 0 for not applicable.
     int bytesSysMem, bytesBlockSize = 0;
 
-    // integer for I/O resource index reference
-    int resourceIndex = -1;
+    // integer for legacy device index reference
+    int deviceIndex = -1;
 
-    Command thisCmd = ClassifyCmd(collectedInfo[1], bytesSysMem, bytesBlockSize, resourceIndex); // first sub_match is command
+    Command thisCmd = ClassifyCmd(collectedInfo[1], bytesSysMem, bytesBlockSize, deviceIndex); // first sub_match is command
 
     // call command handling functions,
     // pass in remainder of command stringstream after delimiter (value for command)
@@ -195,19 +342,11 @@ void Configuration::parseCommandString(std::string cmdString) {
                             break;
         case MDF:           handleMdf(collectedInfo[2]);
                             break;
-        case PROJECTOR:     handleTime(collectedInfo[2], PROJECTOR);
-                            break;
         case PROCESSOR:     handleTime(collectedInfo[2], PROCESSOR);
                             break;
-        case KEYBOARD:      handleTime(collectedInfo[2], KEYBOARD);
-                            break;
-        case MONITOR:       handleTime(collectedInfo[2], MONITOR);
-                            break;
-        case SCANNER:       handleTime(collectedInfo[2], SCANNER);
-                            break;
         case MEMORY:      	handleTime(collectedInfo[2], MEMORY);
                             break;
-        case HARD_DRIVE:    handleTime(collectedInfo[2], HARD_DRIVE);
+        case DEVICE_TIME:   handleDeviceTime(collectedInfo[2], deviceIndex);
                             break;
         case LOG:           handleLog(collectedInfo[2]);
                             break;
@@ -217,12 +356,63 @@ void Configuration::parseCommandString(std::string cmdString) {
                             break;
         case BLOCK_SIZE:    handleBlockSize(collectedInfo[2], bytesBlockSize);
                             break; 
-        case RESOURCE:      handleResource(collectedInfo[2], resourceIndex);
+        case RESOURCE:      handleResource(collectedInfo[2], deviceIndex);
+                            break;
+        case DEVICE:        devices_.define(collectedInfo[2]);
+                            break;
+        case DEVICE_BATCH:  devices_.defineBatching(collectedInfo[2]);
                             break;
         case PQN:           handlePQN(collectedInfo[2]);
                             break;      
         case SCHED_CODE:    handleSchedCode(collectedInfo[2]);
                             break;            
+        case CLOCK:         handleClock(collectedInfo[2]);
+                            break;
+        case ARRIVAL_MODE:  handleArrivalMode(collectedInfo[2]);
+                            break;
+        case ARRIVAL_FILE:  arrivalFilePath_ = collectedInfo[2];
+                            break;
+        case CHECKPOINT_FILE: checkpointFilePath_ = collectedInfo[2];
+                            break;
+        case RESTORE_FILE:  restoreFilePath_ = collectedInfo[2];
+                            break;
+        case ARRIVAL_RATE:  handleArrivalRate(collectedInfo[2]);
+                            break;
+        case ARRIVAL_COUNT:     
+        case ARRIVAL_SEED:      
+        case RELOAD_COUNT:      
+        case RELOAD_INTERVAL:   
+        case TLB_ENTRIES:       
+        case DISK_TRACKS:       
+        case SEEK_PER_TRACK:    
+        case SEEK_SETTLE:       
+        case REPLAY_SEED:       
+        case SERVICE_JITTER:    
+        case CHECKPOINT_TIME:   
+        case CONTEXT_SWITCH:    
+        case CACHE_REFILL:      
+        case CACHE_WARM:        
+        case CACHE_LINE:        
+        case MEMORY_ACCESS:     
+        case CACHE_ACCESSES:    
+        case STR_AGING:         
+        case ADMISSION_LIMIT:   
+        case METRICS_INTERVAL:  handleCount(collectedInfo[2], thisCmd);
+                            break;
+        case MEMORY_MODE:   handleMemoryMode(collectedInfo[2]);
+                            break;
+        case PAGE_POLICY:   handlePagePolicy(collectedInfo[2]);
+                            break;
+        case DISK_POLICY:   handleDiskPolicy(collectedInfo[2]);
+                            break;
+        case CACHE_LEVEL:   handleCacheLevel(collectedInfo[2]);
+                            break;
+        case ADMISSION_POLICY: handleAdmissionPolicy(collectedInfo[2]);
+                            break;
+        case METRICS_FILE:  metricsFilePath_ = collectedInfo[2];
+                            break;
+        case METRICS_FORMAT: handleMetricsFormat(collectedInfo[2]);
+                            break;
         case UNKNOWN:       throw std::logic_error("Configuration Class: Invalid Command In Configuration File");
     }
 }
@@ -233,24 +423,54 @@ void Configuration::parseCommandString(std::string cmdString) {
  * @param[in]  command  (std::string) The command
  * @param[in]  bytesSysMem  (int&) integer reference for kB=1, MB=2, or GB=3. 0 for not applicable.
  * @param[in]  bytesSysMem  (int&) integer reference for kB=1, MB=2, or GB=3. 0 for not applicable.
- * @param[in]  resourceIndex  (int&) index of resource in ioResources_ array.
+ * @param[in]  deviceIndex  (int&) index of the device in LEGACY_DEVICES.
  *
  * @return     (enum) The corresponding enum value if found
  */
-Command Configuration::ClassifyCmd(std::string command, int& bytesSysMem, int& bytesBlockSize, int& resourceIndex) {
+Command Configuration::ClassifyCmd(std::string command, int& bytesSysMem, int& bytesBlockSize, int& deviceIndex) {
     if (command == "Version/Phase") return VERSION;
     else if (command == "File Path") return MDF;
     else if (command == "Quantum Number {msec}") return PQN;
     else if (command == "CPU Scheduling Code") return SCHED_CODE;
-    else if (command == "Projector cycle time {msec}") return PROJECTOR;
+    else if (command == "STR aging {percent}") return STR_AGING;
     else if (command == "Processor cycle time {msec}") return PROCESSOR;
-    else if (command == "Keyboard cycle time {msec}") return KEYBOARD;
-    else if (command == "Monitor display time {msec}") return MONITOR;
-    else if (command == "Scanner cycle time {msec}") return SCANNER;
-    else if (command == "Hard drive cycle time {msec}") return HARD_DRIVE;
     else if (command == "Memory cycle time {msec}") return MEMORY;
+    else if (command == "Device") return DEVICE;
+    else if (command == "Device batching") return DEVICE_BATCH;
     else if (command == "Log") return LOG;
     else if (command == "Log File Path") return LOG_FILE;
+    else if (command == "Simulation clock") return CLOCK;
+    else if (command == "Arrival mode") return ARRIVAL_MODE;
+    else if (command == "Admission limit") return ADMISSION_LIMIT;
+    else if (command == "Admission policy") return ADMISSION_POLICY;
+    else if (command == "Arrival file path") return ARRIVAL_FILE;
+    else if (command == "Arrival rate {per sec}") return ARRIVAL_RATE;
+    else if (command == "Arrival count") return ARRIVAL_COUNT;
+    else if (command == "Arrival seed") return ARRIVAL_SEED;
+    else if (command == "Reload count") return RELOAD_COUNT;
+    else if (command == "Reload interval {msec}") return RELOAD_INTERVAL;
+    else if (command == "Memory management") return MEMORY_MODE;
+    else if (command == "Page replacement") return PAGE_POLICY;
+    else if (command == "TLB entries") return TLB_ENTRIES;
+    else if (command == "Disk scheduling") return DISK_POLICY;
+    else if (command == "Disk tracks") return DISK_TRACKS;
+    else if (command == "Seek time per track {usec}") return SEEK_PER_TRACK;
+    else if (command == "Seek settle time {usec}") return SEEK_SETTLE;
+    else if (command == "Replay seed") return REPLAY_SEED;
+    else if (command == "Service time jitter {percent}") return SERVICE_JITTER;
+    else if (command == "Checkpoint time {msec}") return CHECKPOINT_TIME;
+    else if (command == "Checkpoint file path") return CHECKPOINT_FILE;
+    else if (command == "Metrics interval {msec}") return METRICS_INTERVAL;
+    else if (command == "Metrics file path") return METRICS_FILE;
+    else if (command == "Metrics format") return METRICS_FORMAT;
+    else if (command == "Restore file path") return RESTORE_FILE;
+    else if (command == "Context switch time {usec}") return CONTEXT_SWITCH;
+    else if (command == "Cache refill time {usec}") return CACHE_REFILL;
+    else if (command == "Cache warm time {msec}") return CACHE_WARM;
+    else if (command == "Cache level") return CACHE_LEVEL;
+    else if (command == "Cache line size {bytes}") return CACHE_LINE;
+    else if (command == "Memory access time {nsec}") return MEMORY_ACCESS;
+    else if (command == "Cache accesses per cycle") return CACHE_ACCESSES;
     else if (command == "System memory {kbytes}") {
         bytesSysMem = 1;
         return SYSMEMORY;
@@ -275,25 +495,17 @@ Command Configuration::ClassifyCmd(std::string command, int& bytesSysMem, int& b
         bytesSysMem = 3;
         return BLOCK_SIZE;
     }
-    else if (command == "Hard drive quantity") {
-        resourceIndex = 0;
-        return RESOURCE;
-    }
-    else if (command == "Keyboard quantity") {
-        resourceIndex = 1;
-        return RESOURCE;
-    }
-    else if (command == "Scanner quantity") {
-        resourceIndex = 2;
-        return RESOURCE;
-    }
-    else if (command == "Monitor quantity") {
-        resourceIndex = 3;
-        return RESOURCE;
-    }
-    else if (command == "Projector quantity") {
-        resourceIndex = 4;
-        return RESOURCE;
+
+    // the keys of the devices that predate the Device command
+    for (int i = 0; i < NUM_LEGACY_DEVICES; i++) {
+        if (command == LEGACY_DEVICES[i].timeKey) {
+            deviceIndex = i;
+            return DEVICE_TIME;
+        }
+        if (command == LEGACY_DEVICES[i].quantityKey) {
+            deviceIndex = i;
+            return RESOURCE;
+        }
     }
 
     return UNKNOWN;
@@ -390,6 +602,7 @@ void Configuration::handleLog(std::string value) {
  * file. Stores the value as an integer for easier interpretation.
  * RR = round robin
  * STR = shortest time remaining (operations left * time per operations)
+ * EDF = earliest deadline first, processes without a deadline last
  *
  * @param[in]  value (std::string) String identifying the algorithm
  */
@@ -398,12 +611,287 @@ void Configuration::handleSchedCode(std::string value) {
         schedCode_ = 0;
     } else if (value == "STR") {
         schedCode_ = 1;
+    } else if (value == "EDF") {
+        schedCode_ = 2;
     } else {
         // throw exception
         throw std::logic_error("Configuration Class: Invalid CPU Scheduling Code");
     }
 }
 
+/**
+ * @brief      Handles the simulation clock command.
+ * 
+ * Real Time = operations take as long as their cycle times
+ * Virtual Time = simulated time only, runs as fast as possible
+ *
+ * @param[in]  value (std::string) String identifying the clock
+ */
+void Configuration::handleClock(std::string value) {
+    if (value == "Real Time") {
+        clockMode_ = 0;
+    } else if (value == "Virtual Time") {
+        clockMode_ = 1;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Simulation Clock");
+    }
+}
+
+/**
+ * @brief      Handles the arrival mode command.
+ * 
+ * Reload = the whole meta data file arrives at start and again every
+ *          reload interval, reload count times
+ * Schedule = each process arrives once, at the time given by its A{begin}
+ *            annotation or the arrival file
+ * Poisson = open-loop arrivals at the arrival rate, cycling through the
+ *           processes in the meta data file
+ *
+ * @param[in]  value (std::string) String identifying the arrival mode
+ */
+void Configuration::handleArrivalMode(std::string value) {
+    if (value == "Reload") {
+        arrivalMode_ = 0;
+    } else if (value == "Schedule") {
+        arrivalMode_ = 1;
+    } else if (value == "Poisson") {
+        arrivalMode_ = 2;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Arrival Mode");
+    }
+}
+
+/**
+ * @brief      Handles the poisson arrival rate command.
+ *
+ * @param[in]  value  (std::string) raw string of value
+ */
+void Configuration::handleArrivalRate(std::string value) {
+    double aRate = atof(value.c_str()); // convert string to double
+
+    if (aRate <= 0) {
+        // throw exception
+        throw std::logic_error("Configuration Class: Arrival Rate is Not Above Zero");
+    }
+
+    arrivalRate_ = aRate;
+}
+
+/**
+ * @brief      Handles the whole number commands that may not be negative.
+ *
+ * @param[in]  value  (std::string) raw string of value
+ * @param[in]  cmd    (enum) The enum value of the interpreted command
+ */
+void Configuration::handleCount(std::string value, Command cmd) {
+    long long aCount = atoll(value.c_str()); // convert string to long long
+
+    if (aCount < 0) {
+        // throw exception
+        throw std::logic_error("Configuration Class: Count is Less Than Zero");
+    }
+
+    switch (cmd) {
+        case ARRIVAL_COUNT:     arrivalCount_ = aCount;
+                                break;
+        case ARRIVAL_SEED:      arrivalSeed_ = aCount;
+                                break;
+        case RELOAD_COUNT:      reloadCount_ = aCount;
+                                break;
+        case RELOAD_INTERVAL:   reloadInterval_ = aCount;
+                                break;
+        case TLB_ENTRIES:       tlbEntries_ = aCount;
+                                break;
+        case DISK_TRACKS:       diskTracks_ = aCount;
+                                break;
+        case SEEK_PER_TRACK:    seekPerTrack_ = aCount;
+                                break;
+        case SEEK_SETTLE:       seekSettle_ = aCount;
+                                break;
+        case REPLAY_SEED:       replaySeed_ = aCount;
+                                break;
+        case SERVICE_JITTER:    if (aCount > 100) {
+                                    // throw exception
+                                    throw std::logic_error("Configuration Class: Service Time Jitter is More Than 100 Percent");
+                                }
+                                serviceJitter_ = aCount;
+                                break;
+        case CHECKPOINT_TIME:   checkpointTime_ = aCount;
+                                break;
+        case CONTEXT_SWITCH:    contextSwitchTime_ = aCount;
+                                break;
+        case CACHE_REFILL:      cacheRefillTime_ = aCount;
+                                break;
+        case CACHE_WARM:        cacheWarmTime_ = aCount;
+                                break;
+        case CACHE_LINE:        if (aCount < 1) {
+                                    // throw exception
+                                    throw std::logic_error("Configuration Class: Cache Line Size is Less Than One");
+                                }
+                                cacheLineSize_ = aCount;
+                                break;
+        case MEMORY_ACCESS:     memoryAccessTime_ = aCount;
+                                break;
+        case CACHE_ACCESSES:    cacheAccesses_ = aCount;
+                                break;
+        case STR_AGING:         strAging_ = aCount;
+                                break;
+        case ADMISSION_LIMIT:   admissionLimit_ = aCount;
+                                break;
+        case METRICS_INTERVAL:  metricsInterval_ = aCount;
+                                break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief      Handles the memory management command.
+ * 
+ * Buddy = M{allocate} takes blocks from a buddy allocator
+ * Paged = demand-paged virtual memory with one frame per memory block
+ *
+ * @param[in]  value (std::string) String identifying the memory management
+ */
+void Configuration::handleMemoryMode(std::string value) {
+    if (value == "Buddy") {
+        memoryMode_ = 0;
+    } else if (value == "Paged") {
+        memoryMode_ = 1;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Memory Management");
+    }
+}
+
+/**
+ * @brief      Handles the page replacement command.
+ *
+ * @param[in]  value (std::string) FIFO, LRU or CLOCK
+ */
+void Configuration::handlePagePolicy(std::string value) {
+    if (value == "FIFO") {
+        pagePolicy_ = 0;
+    } else if (value == "LRU") {
+        pagePolicy_ = 1;
+    } else if (value == "CLOCK") {
+        pagePolicy_ = 2;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Page Replacement");
+    }
+}
+
+/**
+ * @brief      Handles the disk scheduling command.
+ * 
+ * Off = hard drive I/O holds the CPU for its cycles, as other devices do
+ * FCFS, SSTF, SCAN, C-LOOK = hard drive I/O is queued on a drive and the
+ *                           process waits off the CPU; the drive orders
+ *                           its queue with the policy
+ *
+ * @param[in]  value (std::string) String identifying the policy
+ */
+void Configuration::handleDiskPolicy(std::string value) {
+    if (value == "Off") {
+        diskPolicy_ = -1;
+    } else if (value == "FCFS") {
+        diskPolicy_ = 0;
+    } else if (value == "SSTF") {
+        diskPolicy_ = 1;
+    } else if (value == "SCAN") {
+        diskPolicy_ = 2;
+    } else if (value == "C-LOOK") {
+        diskPolicy_ = 3;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Disk Scheduling");
+    }
+}
+
+/**
+ * @brief      Handles the admission policy command, which decides what
+ *             happens to an arrival while the admission limit is reached.
+ * 
+ * Queue = the arrival waits in the arrival schedule and keeps its arrival
+ *         time, so its turnaround includes the wait
+ * Reject = the arrival is dropped and counted
+ * Throttle = the source pauses while the arrival waits: it arrives when it
+ *            is admitted, and every later arrival comes that much later
+ *
+ * @param[in]  value (std::string) String identifying the policy
+ */
+void Configuration::handleAdmissionPolicy(std::string value) {
+    if (value == "Queue") {
+        admissionPolicy_ = 0;
+    } else if (value == "Reject") {
+        admissionPolicy_ = 1;
+    } else if (value == "Throttle") {
+        admissionPolicy_ = 2;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Admission Policy");
+    }
+}
+
+/**
+ * @brief      Handles the metrics format command.
+ *
+ * @param[in]  value (std::string) CSV or Prometheus
+ */
+void Configuration::handleMetricsFormat(std::string value) {
+    if (value == "CSV") {
+        metricsFormat_ = 0;
+    } else if (value == "Prometheus") {
+        metricsFormat_ = 1;
+    } else {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Metrics Format");
+    }
+}
+
+/**
+ * @brief      Handles the cache level command. Levels are listed nearest
+ *             the CPU first, and a level named again is replaced.
+ *
+ * Format: <name>, <size kbytes>, <ways>, <hit time nsec>
+ * e.g.    L1, 32, 8, 1
+ *
+ * @param[in]  value  (std::string) raw string of value
+ */
+void Configuration::handleCacheLevel(std::string value) {
+    std::regex specRE("^[\\s]*([A-Za-z0-9]+)[\\s]*,[\\s]*([0-9]+)[\\s]*,[\\s]*([0-9]+)"
+                      "[\\s]*,[\\s]*([0-9]+)[\\s]*$");
+    std::smatch collectedInfo;
+
+    if (!std::regex_match(value, collectedInfo, specRE)) {
+        // throw exception
+        throw std::logic_error("Configuration Class: Invalid Cache Level");
+    }
+
+    CacheLevelSpec aLevel;
+    aLevel.name = collectedInfo.str(1);
+    aLevel.size = atoi(collectedInfo.str(2).c_str());
+    aLevel.ways = atoi(collectedInfo.str(3).c_str());
+    aLevel.hitTime = atoi(collectedInfo.str(4).c_str());
+
+    if ((aLevel.size < 1) || (aLevel.ways < 1)) {
+        // throw exception
+        throw std::logic_error("Configuration Class: Cache Level Size or Ways is Less Than One");
+    }
+
+    for (unsigned int i = 0; i < cacheLevels_.size(); i++) {
+        if (cacheLevels_[i].name == aLevel.name) {
+            cacheLevels_[i] = aLevel;
+            return;
+        }
+    }
+
+    cacheLevels_.push_back(aLevel);
+}
+
 /**
  * @brief      Handles the system memory command.
  *
@@ -459,10 +947,10 @@ void Configuration::handleBlockSize(std::string value, int bytesBlockSize) {
 /**
  * @brief      Handles the resource number command.
  *
- * @param[in]  value          (std::string) the raw string of the value
- * @param[in]  resourceIndex  (int) the index of the resource in the array.
+ * @param[in]  value        (std::string) the raw string of the value
+ * @param[in]  deviceIndex  (int) the index of the device in LEGACY_DEVICES.
  */
-void Configuration::handleResource(std::string value, int resourceIndex) {
+void Configuration::handleResource(std::string value, int deviceIndex) {
     int aSize = atoi(value.c_str()); // convert string to int
 
     if (aSize < 1) {
@@ -470,7 +958,24 @@ void Configuration::handleResource(std::string value, int resourceIndex) {
         throw std::logic_error("Configuration Class: Resource Size is Less Than One");
     }
 
-    ioResources_[resourceIndex] = aSize;
+    devices_.defineLegacyQuantity(deviceIndex, aSize);
+}
+
+/**
+ * @brief      Handles the cycle time command of a legacy device.
+ *
+ * @param[in]  value        (std::string) raw string of value
+ * @param[in]  deviceIndex  (int) the index of the device in LEGACY_DEVICES.
+ */
+void Configuration::handleDeviceTime(std::string value, int deviceIndex) {
+    int aTime = atoi(value.c_str()); // convert string to int
+
+    if (aTime < 0) {
+        // throw exception
+        throw std::logic_error("Configuration Class: Time is Less Than Zero");
+    }
+
+    devices_.defineLegacyTime(deviceIndex, aTime);
 }
 
 /**
@@ -496,42 +1001,12 @@ void Configuration::handleTime(std::string value, Command cmd) {
     // create CycleTime obj.
     // assign key value pair to map
     switch (cmd) {
-        case PROJECTOR:
-        {
-            CycleTime aCycTime("Projector", aTime);
-            timeMap_.insert({"projector", aCycTime});
-            break;
-        }
         case PROCESSOR:
         {
             CycleTime aCycTime("Processor", aTime);
             timeMap_.insert({"processor", aCycTime});
             break;
         }
-        case KEYBOARD:
-        {
-            CycleTime aCycTime("Keyboard", aTime);
-            timeMap_.insert({"keyboard", aCycTime});
-            break;
-        }
-        case MONITOR:
-        {
-            CycleTime aCycTime("Monitor", aTime);
-            timeMap_.insert({"monitor", aCycTime});
-            break;
-        }
-        case SCANNER:
-        {
-            CycleTime aCycTime("Scanner", aTime);
-            timeMap_.insert({"scanner", aCycTime});
-            break;
-        }
-        case HARD_DRIVE:
-        {
-            CycleTime aCycTime("Hard Drive", aTime);
-            timeMap_.insert({"hardDrive", aCycTime});
-            break;
-        }
         case MEMORY:
         {
             CycleTime aCycTime("Memory", aTime);
@@ -600,20 +1075,12 @@ int Configuration::getBlockSize() const {
 
 
 /**
- * @brief      Gets the number of resourses allocated to I/O device
- *
- * @param[in]  (int) resourceIndex  The index of the I/O resource in the array
- *                                  Indices:
-                                        0 = hard drive
-                                        1 = keyboard
-                                        2 = scanner
-                                        3 = monitor
-                                        4 = projector
+ * @brief      Gets the I/O devices.
  *
- * @return     (int) The number of resourses allocated to I/O device.
+ * @return     (const DeviceRegistry&) The devices in the order declared.
  */
-int Configuration::getResourceSize(int resourceIndex) const {
-    return ioResources_[resourceIndex];
+const DeviceRegistry& Configuration::getDevices() const {
+    return devices_;
 }
 
 
@@ -651,4 +1118,142 @@ int Configuration::getPQN() const {
     return pqn_;
 }
 
+/**
+ * @brief      Gets the clock mode. A replay always runs in virtual time, so
+ *             that its log does not depend on the host.
+ *
+ * @return     (int) 0 for real time, 1 for virtual time
+ */
+int Configuration::getClockMode() const {
+    return (replaySeed_ >= 0) ? 1 : clockMode_;
+}
+
+int Configuration::getArrivalMode() const {
+    return arrivalMode_;
+}
+
+std::string Configuration::getArrivalFilePath() const {
+    return arrivalFilePath_;
+}
+
+double Configuration::getArrivalRate() const {
+    return arrivalRate_;
+}
+
+int Configuration::getArrivalCount() const {
+    return arrivalCount_;
+}
+
+unsigned long long Configuration::getArrivalSeed() const {
+    return arrivalSeed_;
+}
+
+int Configuration::getReloadCount() const {
+    return reloadCount_;
+}
+
+int Configuration::getReloadInterval() const {
+    return reloadInterval_;
+}
+
+int Configuration::getMemoryMode() const {
+    return memoryMode_;
+}
+
+int Configuration::getPagePolicy() const {
+    return pagePolicy_;
+}
+
+int Configuration::getTLBEntries() const {
+    return tlbEntries_;
+}
+
+int Configuration::getDiskPolicy() const {
+    return diskPolicy_;
+}
+
+int Configuration::getDiskTracks() const {
+    return diskTracks_;
+}
+
+int Configuration::getSeekPerTrack() const {
+    return seekPerTrack_;
+}
+
+int Configuration::getSeekSettle() const {
+    return seekSettle_;
+}
+
+long long Configuration::getReplaySeed() const {
+    return replaySeed_;
+}
+
+int Configuration::getServiceJitter() const {
+    return serviceJitter_;
+}
+
+int Configuration::getCheckpointTime() const {
+    return checkpointTime_;
+}
+
+std::string Configuration::getCheckpointFilePath() const {
+    return checkpointFilePath_;
+}
+
+std::string Configuration::getRestoreFilePath() const {
+    return restoreFilePath_;
+}
+
+int Configuration::getContextSwitchTime() const {
+    return contextSwitchTime_;
+}
+
+int Configuration::getCacheRefillTime() const {
+    return cacheRefillTime_;
+}
+
+int Configuration::getCacheWarmTime() const {
+    return cacheWarmTime_;
+}
+
+const std::vector<CacheLevelSpec>& Configuration::getCacheLevels() const {
+    return cacheLevels_;
+}
+
+int Configuration::getCacheLineSize() const {
+    return cacheLineSize_;
+}
+
+int Configuration::getMemoryAccessTime() const {
+    return memoryAccessTime_;
+}
+
+int Configuration::getCacheAccesses() const {
+    return cacheAccesses_;
+}
+
+int Configuration::getSTRAging() const {
+    return strAging_;
+}
+
+int Configuration::getAdmissionLimit() const {
+    return admissionLimit_;
+}
+
+int Configuration::getAdmissionPolicy() const {
+    return admissionPolicy_;
+}
+
+int Configuration::getMetricsInterval() const {
+    return metricsInterval_;
+}
+
+std::string Configuration::getMetricsFilePath() const {
+    return metricsFilePath_;
+}
+
+int Configuration::getMetricsFormat() const {
+    return metricsFormat_;
+}
+
 #endif
\ No newline at end of file
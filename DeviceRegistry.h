@@ -0,0 +1,254 @@
+/**
+ *  @file    DeviceRegistry.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _DEVICE_REGISTRY
+#define _DEVICE_REGISTRY
+
+#include <string>
+#include <vector>
+#include <regex>
+#include <stdexcept>
+
+
+/**
+ * @brief      Struct for one type of I/O device.
+ */
+struct DeviceType {
+    std::string name; // meta data descriptor, e.g. "hard drive"
+    std::string unitPrefix; // units are named <prefix>_0, <prefix>_1, ...
+    bool input; // allowed in I{} operations
+    bool output; // allowed in O{} operations
+    int cycleTime; // msec per cycle, -1 until given
+    int quantity; // number of units
+    int batchWindow; // msec a batch of requests stays open, -1 for no batching
+};
+
+/**
+ * @brief      Struct for the configuration keys of a device that predates the
+ *             Device command.
+ */
+struct LegacyDevice {
+    const char* timeKey;
+    const char* quantityKey;
+    const char* name;
+    const char* unitPrefix;
+    bool input;
+    bool output;
+};
+
+// The devices with their own configuration keys
+const LegacyDevice LEGACY_DEVICES[] = {
+    {"Hard drive cycle time {msec}", "Hard drive quantity", "hard drive", "HDD", true, true},
+    {"Keyboard cycle time {msec}", "Keyboard quantity", "keyboard", "KBRD", true, false},
+    {"Scanner cycle time {msec}", "Scanner quantity", "scanner", "SCNR", true, false},
+    {"Monitor display time {msec}", "Monitor quantity", "monitor", "MNTR", false, true},
+    {"Projector cycle time {msec}", "Projector quantity", "projector", "PROJ", false, true}
+};
+
+const int NUM_LEGACY_DEVICES = 5; // the number of devices in LEGACY_DEVICES
+
+
+/**
+ * @brief      Class for the I/O devices declared in the configuration file.
+ *
+ * Devices are kept in the order they were declared, and a device's index is
+ * used everywhere after parsing: meta commands store it and the runner keeps
+ * the state of each device at the same index.
+ */
+class DeviceRegistry
+{
+public:
+    // PUBLIC FUNCTIONS
+    void define(std::string spec);
+    void defineLegacyTime(int legacyIndex, int cycleTime);
+    void defineLegacyQuantity(int legacyIndex, int quantity);
+    void defineBatching(std::string spec);
+    int find(std::string name) const;
+
+    // GETTER FUNCTIONS
+    int size() const;
+    const DeviceType& get(int index) const;
+
+private:
+    // PRIVATE DATA
+    std::vector<DeviceType> devices_;
+
+    // PRIVATE FUNCTIONS
+    DeviceType& entryFor(std::string name, std::string unitPrefix);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Defines a device from the value of a Device command.
+ *
+ * Format: <name>, <Input|Output|Input Output>, <cycle time msec>, <quantity>
+ * e.g.    nvme, Input Output, 2, 4
+ *
+ * The name is the meta data descriptor, so it may only hold lowercase
+ * letters and spaces. Units are named after the name in uppercase.
+ *
+ * @param[in]  spec  (std::string) The raw string of the value
+ */
+void DeviceRegistry::define(std::string spec) {
+    /* Regex:
+            ([a-z][a-z ]*[a-z]|[a-z]) the name, without surrounding spaces
+            (Input Output|Input|Output) the direction
+            ([0-9]+) the cycle time and the quantity
+    */
+    std::regex specRE("^[\\s]*([a-z][a-z ]*[a-z]|[a-z])[\\s]*,[\\s]*(Input Output|Input|Output)"
+                      "[\\s]*,[\\s]*([0-9]+)[\\s]*,[\\s]*([0-9]+)[\\s]*$");
+    std::smatch collectedInfo;
+
+    if (!std::regex_match(spec, collectedInfo, specRE)) {
+        // throw exception
+        throw std::logic_error("DeviceRegistry Class: Invalid Device Specification");
+    }
+
+    std::string name = collectedInfo.str(1);
+    std::string unitPrefix = name;
+
+    for (unsigned int i = 0; i < unitPrefix.size(); i++) {
+        unitPrefix[i] = (unitPrefix[i] == ' ') ? '_' : toupper(unitPrefix[i]);
+    }
+
+    int quantity = atoi(collectedInfo.str(4).c_str());
+
+    if (quantity < 1) {
+        // throw exception
+        throw std::logic_error("DeviceRegistry Class: Resource Size is Less Than One");
+    }
+
+    DeviceType& aDevice = entryFor(name, unitPrefix);
+    aDevice.input = (collectedInfo.str(2) != "Output");
+    aDevice.output = (collectedInfo.str(2) != "Input");
+    aDevice.cycleTime = atoi(collectedInfo.str(3).c_str());
+    aDevice.quantity = quantity;
+}
+
+/**
+ * @brief      Sets the cycle time of a legacy device, e.g. from
+ *             "Hard drive cycle time {msec}".
+ *
+ * @param[in]  legacyIndex  (int) The index in LEGACY_DEVICES
+ * @param[in]  cycleTime    (int) The msec per cycle
+ */
+void DeviceRegistry::defineLegacyTime(int legacyIndex, int cycleTime) {
+    const LegacyDevice& legacy = LEGACY_DEVICES[legacyIndex];
+
+    entryFor(legacy.name, legacy.unitPrefix).cycleTime = cycleTime;
+}
+
+/**
+ * @brief      Sets the quantity of a legacy device, e.g. from
+ *             "Hard drive quantity".
+ *
+ * @param[in]  legacyIndex  (int) The index in LEGACY_DEVICES
+ * @param[in]  quantity     (int) The number of units
+ */
+void DeviceRegistry::defineLegacyQuantity(int legacyIndex, int quantity) {
+    const LegacyDevice& legacy = LEGACY_DEVICES[legacyIndex];
+
+    entryFor(legacy.name, legacy.unitPrefix).quantity = quantity;
+}
+
+/**
+ * @brief      Turns on request batching for a device from the value of a
+ *             Device batching command.
+ *
+ * Format: <name>, <window msec>
+ * e.g.    monitor, 5
+ *
+ * The device may be declared before or after its batching.
+ *
+ * @param[in]  spec  (std::string) The raw string of the value
+ */
+void DeviceRegistry::defineBatching(std::string spec) {
+    std::regex specRE("^[\\s]*([a-z][a-z ]*[a-z]|[a-z])[\\s]*,[\\s]*([0-9]+)[\\s]*$");
+    std::smatch collectedInfo;
+
+    if (!std::regex_match(spec, collectedInfo, specRE)) {
+        // throw exception
+        throw std::logic_error("DeviceRegistry Class: Invalid Device Batching Specification");
+    }
+
+    std::string name = collectedInfo.str(1);
+    std::string unitPrefix = name;
+
+    for (int i = 0; i < NUM_LEGACY_DEVICES; i++) {
+        if (name == LEGACY_DEVICES[i].name) {
+            unitPrefix = LEGACY_DEVICES[i].unitPrefix;
+        }
+    }
+    if (unitPrefix == name) {
+        for (unsigned int i = 0; i < unitPrefix.size(); i++) {
+            unitPrefix[i] = (unitPrefix[i] == ' ') ? '_' : toupper(unitPrefix[i]);
+        }
+    }
+
+    entryFor(name, unitPrefix).batchWindow = atoi(collectedInfo.str(2).c_str());
+}
+
+/**
+ * @brief      Finds a device by name.
+ *
+ * @param[in]  name  (std::string) The device name
+ *
+ * @return     (int) The index of the device, -1 if it is not declared.
+ */
+int DeviceRegistry::find(std::string name) const {
+    for (unsigned int i = 0; i < devices_.size(); i++) {
+        if (devices_[i].name == name) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief      Gets the device with a name, adding it if it is new. Legacy
+ *             devices take their direction from LEGACY_DEVICES.
+ *
+ * @param[in]  name        (std::string) The device name
+ * @param[in]  unitPrefix  (std::string) The prefix of the unit names
+ *
+ * @return     (DeviceType&) The device.
+ */
+DeviceType& DeviceRegistry::entryFor(std::string name, std::string unitPrefix) {
+    int index = find(name);
+
+    if (index >= 0) {
+        return devices_[index];
+    }
+
+    DeviceType aDevice = {name, unitPrefix, true, true, -1, 1, -1};
+
+    for (int i = 0; i < NUM_LEGACY_DEVICES; i++) {
+        if (name == LEGACY_DEVICES[i].name) {
+            aDevice.input = LEGACY_DEVICES[i].input;
+            aDevice.output = LEGACY_DEVICES[i].output;
+        }
+    }
+
+    devices_.push_back(aDevice);
+
+    return devices_.back();
+}
+
+int DeviceRegistry::size() const {
+    return devices_.size();
+}
+
+const DeviceType& DeviceRegistry::get(int index) const {
+    return devices_[index];
+}
+
+#endif
@@ -0,0 +1,498 @@
+/**
+ *  @file    DiskScheduler.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _DISK_SCHEDULER
+#define _DISK_SCHEDULER
+
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for the request queues of the hard drives.
+ *
+ * A request is queued on the drive with the fewest requests, and each drive
+ * serves its queue one request at a time in the order chosen by the policy.
+ * A request takes the seek from the head's track to the request's track,
+ * then its transfer time. A request without a track is served wherever the
+ * head is. Times are in microseconds on the simulator's clock.
+ *
+ * FCFS = in the order submitted
+ * SSTF = the request nearest the head
+ * SCAN = the nearest request in the head's direction; with none left the
+ *        head runs to the edge of the disk and turns around
+ * C-LOOK = the nearest request at or above the head; with none left the
+ *          head returns to the lowest request
+ */
+class DiskScheduler
+{
+public:
+    // Ordering policy enum
+    enum Policy {FCFS, SSTF, SCAN, CLOOK};
+
+    // Struct for a finished request
+    struct Completion {
+        int id; // the caller's request id
+        int drive;
+        long long submitTime;
+        long long finishTime;
+    };
+
+    // Default Constructor
+    DiskScheduler() {
+        numTracks_ = 1;
+        policy_ = FCFS;
+        seekSettle_ = 0;
+        seekPerTrack_ = 0;
+        numRequests_ = 0;
+        totalSeekTracks_ = 0;
+        totalResponse_ = 0;
+        maxResponse_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(int numDrives, int numTracks, Policy policy,
+                    long long seekSettleMicros, long long seekPerTrackMicros);
+    int submit(int id, int track, long long transferMicros, long long now);
+    bool popCompleted(long long now, Completion& aCompletion);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    bool hasPending() const;
+    long long nextCompletionTime() const;
+    int getNumBusy() const;
+    long getNumRequests() const;
+    long long getTotalSeekTracks() const;
+    double getMeanResponseMicros() const;
+    long long getMaxResponseMicros() const;
+
+private:
+    // Struct for a queued request
+    struct Request {
+        int id;
+        int track; // -1 for wherever the head is
+        long long transferMicros;
+        long long submitTime;
+    };
+
+    // Struct for one drive
+    struct Drive {
+        int head; // track under the head
+        int direction; // +1 toward the last track, -1 toward track 0
+        bool busy;
+        Request current;
+        long long finishTime; // of the current request
+        std::vector<Request> queue; // in the order submitted
+    };
+
+    // PRIVATE DATA
+    std::vector<Drive> drives_;
+    int numTracks_;
+    Policy policy_;
+    long long seekSettle_; // microseconds for any seek
+    long long seekPerTrack_; // microseconds per track crossed
+    long numRequests_;
+    long long totalSeekTracks_;
+    long long totalResponse_;
+    long long maxResponse_;
+
+    // PRIVATE FUNCTIONS
+    void startNext(Drive& aDrive, long long startTime);
+    int pickNext(const Drive& aDrive) const;
+    int distance(const Drive& aDrive, const Request& aRequest) const;
+    static void saveRequest(CheckpointWriter& out, const Request& aRequest);
+    static Request restoreRequest(CheckpointReader& in);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets up idle drives with their heads on track 0.
+ *
+ * @param[in]  numDrives           (int) The number of drives
+ * @param[in]  numTracks           (int) The tracks per drive
+ * @param[in]  policy              (Policy) The ordering policy
+ * @param[in]  seekSettleMicros    (long long) The fixed part of a seek
+ * @param[in]  seekPerTrackMicros  (long long) The seek time per track crossed
+ */
+void DiskScheduler::initialize(int numDrives, int numTracks, Policy policy,
+                               long long seekSettleMicros, long long seekPerTrackMicros) {
+    if ((numDrives < 1) || (numTracks < 1)) {
+        // throw exception
+        throw std::logic_error("DiskScheduler Class: Number of Drives or Tracks is Less Than One");
+    }
+
+    Drive idleDrive;
+    idleDrive.head = 0;
+    idleDrive.direction = 1;
+    idleDrive.busy = false;
+    idleDrive.finishTime = 0;
+    idleDrive.current.id = -1;
+    idleDrive.current.track = -1;
+    idleDrive.current.transferMicros = 0;
+    idleDrive.current.submitTime = 0;
+
+    drives_.assign(numDrives, idleDrive);
+    numTracks_ = numTracks;
+    policy_ = policy;
+    seekSettle_ = seekSettleMicros;
+    seekPerTrack_ = seekPerTrackMicros;
+}
+
+/**
+ * @brief      Queues a request on the drive with the fewest requests. The
+ *             caller must pop the completions due by now first, so that the
+ *             drives are up to date.
+ *
+ * @param[in]  id              (int) The caller's request id
+ * @param[in]  track           (int) The track, -1 for any
+ * @param[in]  transferMicros  (long long) The transfer time
+ * @param[in]  now             (long long) The current time
+ *
+ * @return     (int) The drive the request was queued on.
+ */
+int DiskScheduler::submit(int id, int track, long long transferMicros, long long now) {
+    int drive = 0;
+
+    for (unsigned int i = 1; i < drives_.size(); i++) {
+        if ((drives_[i].queue.size() + drives_[i].busy) <
+            (drives_[drive].queue.size() + drives_[drive].busy)) {
+            drive = i;
+        }
+    }
+
+    Request aRequest = {id, track, transferMicros, now};
+    drives_[drive].queue.push_back(aRequest);
+
+    if (!drives_[drive].busy) {
+        startNext(drives_[drive], now);
+    }
+
+    return drive;
+}
+
+/**
+ * @brief      Takes the earliest request that finished by now, and starts
+ *             the next request on its drive at the time it finished.
+ *
+ * @param[in]  now          (long long) The current time
+ * @param      aCompletion  (Completion&) The finished request
+ *
+ * @return     true if a request had finished.
+ */
+bool DiskScheduler::popCompleted(long long now, Completion& aCompletion) {
+    int drive = -1;
+
+    for (unsigned int i = 0; i < drives_.size(); i++) {
+        if (drives_[i].busy && (drives_[i].finishTime <= now) &&
+            ((drive < 0) || (drives_[i].finishTime < drives_[drive].finishTime))) {
+            drive = i;
+        }
+    }
+
+    if (drive < 0) {
+        return false;
+    }
+
+    Drive& aDrive = drives_[drive];
+
+    aCompletion.id = aDrive.current.id;
+    aCompletion.drive = drive;
+    aCompletion.submitTime = aDrive.current.submitTime;
+    aCompletion.finishTime = aDrive.finishTime;
+
+    long long response = aDrive.finishTime - aDrive.current.submitTime;
+    numRequests_++;
+    totalResponse_ += response;
+    if (response > maxResponse_) {
+        maxResponse_ = response;
+    }
+
+    aDrive.busy = false;
+    if (!aDrive.queue.empty()) {
+        startNext(aDrive, aDrive.finishTime);
+    }
+
+    return true;
+}
+
+/**
+ * @brief      Starts the request the policy picks on an idle drive.
+ *
+ * @param      aDrive     (Drive&) The drive
+ * @param[in]  startTime  (long long) The time the drive starts
+ */
+void DiskScheduler::startNext(Drive& aDrive, long long startTime) {
+    int next = pickNext(aDrive);
+    Request aRequest = aDrive.queue[next];
+    int tracks = distance(aDrive, aRequest);
+
+    aDrive.queue.erase(aDrive.queue.begin() + next);
+
+    // Move the head, turning around for SCAN and C-LOOK when it passes back
+    if (aRequest.track >= 0) {
+        if (aRequest.track > aDrive.head) {
+            aDrive.direction = 1;
+        }
+        else if ((aRequest.track < aDrive.head) && (policy_ == SCAN)) {
+            aDrive.direction = -1;
+        }
+        aDrive.head = aRequest.track;
+    }
+
+    totalSeekTracks_ += tracks;
+
+    aDrive.busy = true;
+    aDrive.current = aRequest;
+    aDrive.finishTime = startTime + aRequest.transferMicros +
+                        ((tracks > 0) ? (seekSettle_ + (tracks * seekPerTrack_)) : 0);
+}
+
+/**
+ * @brief      Picks the next request of a drive with the policy.
+ *
+ * @param[in]  aDrive  (const Drive&) The drive, with a non-empty queue
+ *
+ * @return     (int) The index of the request in the queue.
+ */
+int DiskScheduler::pickNext(const Drive& aDrive) const {
+    const std::vector<Request>& queue = aDrive.queue;
+    int best = 0;
+
+    switch (policy_) {
+        case FCFS:
+            break;
+        case SSTF:
+            for (unsigned int i = 1; i < queue.size(); i++) {
+                if (distance(aDrive, queue[i]) < distance(aDrive, queue[best])) {
+                    best = i;
+                }
+            }
+            break;
+        case SCAN:
+        case CLOOK:
+        {
+            // nearest request ahead of the head, or at it
+            best = -1;
+            for (unsigned int i = 0; i < queue.size(); i++) {
+                int track = (queue[i].track < 0) ? aDrive.head : queue[i].track;
+                bool ahead = (policy_ == CLOOK) ? (track >= aDrive.head)
+                                                : (((track - aDrive.head) * aDrive.direction) >= 0);
+
+                if (ahead && ((best < 0) || (distance(aDrive, queue[i]) < distance(aDrive, queue[best])))) {
+                    best = i;
+                }
+            }
+            if (best >= 0) {
+                break;
+            }
+
+            // none ahead: SCAN turns around and takes the nearest behind,
+            // C-LOOK returns to the lowest track
+            best = 0;
+            for (unsigned int i = 1; i < queue.size(); i++) {
+                if ((policy_ == SCAN) ? (distance(aDrive, queue[i]) < distance(aDrive, queue[best]))
+                                      : (queue[i].track < queue[best].track)) {
+                    best = i;
+                }
+            }
+            break;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief      Gets the tracks the head crosses to reach a request. A SCAN
+ *             head behind the request runs to the edge of the disk first.
+ *
+ * @param[in]  aDrive    (const Drive&) The drive
+ * @param[in]  aRequest  (const Request&) The request
+ *
+ * @return     (int) The number of tracks.
+ */
+int DiskScheduler::distance(const Drive& aDrive, const Request& aRequest) const {
+    if (aRequest.track < 0) {
+        return 0;
+    }
+
+    int direct = abs(aRequest.track - aDrive.head);
+
+    if ((policy_ == SCAN) && (((aRequest.track - aDrive.head) * aDrive.direction) < 0)) {
+        int edge = (aDrive.direction > 0) ? (numTracks_ - 1) : 0;
+        return abs(edge - aDrive.head) + abs(edge - aRequest.track);
+    }
+
+    return direct;
+}
+
+/**
+ * @brief      Checks for requests queued or in service.
+ *
+ * @return     true if a drive is busy.
+ */
+bool DiskScheduler::hasPending() const {
+    for (unsigned int i = 0; i < drives_.size(); i++) {
+        if (drives_[i].busy) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief      Gets the time the next request finishes. Only valid if
+ *             hasPending().
+ *
+ * @return     (long long) The time in microseconds.
+ */
+long long DiskScheduler::nextCompletionTime() const {
+    long long next = -1;
+
+    for (unsigned int i = 0; i < drives_.size(); i++) {
+        if (drives_[i].busy && ((next < 0) || (drives_[i].finishTime < next))) {
+            next = drives_[i].finishTime;
+        }
+    }
+
+    return next;
+}
+
+/**
+ * @brief      Gets the number of drives serving a request.
+ *
+ * @return     (int) The number of busy drives.
+ */
+int DiskScheduler::getNumBusy() const {
+    int numBusy = 0;
+
+    for (unsigned int i = 0; i < drives_.size(); i++) {
+        numBusy += drives_[i].busy ? 1 : 0;
+    }
+
+    return numBusy;
+}
+
+long DiskScheduler::getNumRequests() const {
+    return numRequests_;
+}
+
+long long DiskScheduler::getTotalSeekTracks() const {
+    return totalSeekTracks_;
+}
+
+/**
+ * @brief      Gets the mean time from submitting a request to its finish.
+ *
+ * @return     (double) The mean response time in microseconds.
+ */
+double DiskScheduler::getMeanResponseMicros() const {
+    if (numRequests_ == 0) {
+        return 0;
+    }
+
+    return (double)totalResponse_ / numRequests_;
+}
+
+long long DiskScheduler::getMaxResponseMicros() const {
+    return maxResponse_;
+}
+
+/**
+ * @brief      Writes the drives, their queues and the statistics to a
+ *             checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void DiskScheduler::save(CheckpointWriter& out) const {
+    out.putInt(drives_.size());
+    for (unsigned int i = 0; i < drives_.size(); i++) {
+        const Drive& aDrive = drives_[i];
+
+        out.putInt(aDrive.head);
+        out.putInt(aDrive.direction);
+        out.putBool(aDrive.busy);
+        saveRequest(out, aDrive.current);
+        out.putInt(aDrive.finishTime);
+
+        out.putInt(aDrive.queue.size());
+        for (unsigned int j = 0; j < aDrive.queue.size(); j++) {
+            saveRequest(out, aDrive.queue[j]);
+        }
+    }
+
+    out.putInt(numRequests_);
+    out.putInt(totalSeekTracks_);
+    out.putInt(totalResponse_);
+    out.putInt(maxResponse_);
+}
+
+/**
+ * @brief      Reads the drives from a checkpoint. The policy and seek times
+ *             are kept from initialize(), and drives beyond those in the
+ *             checkpoint start idle, so a restored run can try another
+ *             policy or more drives.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void DiskScheduler::restore(CheckpointReader& in) {
+    long long numDrives = in.getInt();
+
+    if (numDrives > (long long)drives_.size()) {
+        // throw exception
+        throw std::logic_error("DiskScheduler Class: Checkpoint Has More Drives Than The Configuration");
+    }
+
+    for (long long i = 0; i < numDrives; i++) {
+        Drive& aDrive = drives_[i];
+
+        aDrive.head = in.getInt();
+        aDrive.direction = in.getInt();
+        aDrive.busy = in.getBool();
+        aDrive.current = restoreRequest(in);
+        aDrive.finishTime = in.getInt();
+
+        aDrive.queue.clear();
+        for (long long j = in.getInt(); j > 0; j--) {
+            aDrive.queue.push_back(restoreRequest(in));
+        }
+    }
+
+    numRequests_ = in.getInt();
+    totalSeekTracks_ = in.getInt();
+    totalResponse_ = in.getInt();
+    maxResponse_ = in.getInt();
+}
+
+void DiskScheduler::saveRequest(CheckpointWriter& out, const Request& aRequest) {
+    out.putInt(aRequest.id);
+    out.putInt(aRequest.track);
+    out.putInt(aRequest.transferMicros);
+    out.putInt(aRequest.submitTime);
+}
+
+DiskScheduler::Request DiskScheduler::restoreRequest(CheckpointReader& in) {
+    Request aRequest;
+
+    aRequest.id = in.getInt();
+    aRequest.track = in.getInt();
+    aRequest.transferMicros = in.getInt();
+    aRequest.submitTime = in.getInt();
+
+    return aRequest;
+}
+
+#endif
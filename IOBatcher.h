@@ -0,0 +1,567 @@
+/**
+ *  @file    IOBatcher.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _IO_BATCHER
+#define _IO_BATCHER
+
+#include <vector>
+#include <deque>
+#include <stdexcept>
+
+#include "DeviceRegistry.h"
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for the batching stage of the I/O devices that batch.
+ *
+ * The first request to a device opens a batch for its direction, and every
+ * request to the same device and direction in the next window joins it.
+ * When the window closes the batch waits for a free unit, and the unit
+ * serves the whole batch in one service interval as long as its longest
+ * request, since the coalesced requests are transferred together. Each
+ * request then completes at the end of the interval. Times are in
+ * microseconds on the simulator's clock.
+ */
+class IOBatcher
+{
+public:
+    // Struct for a finished request
+    struct Completion {
+        int id; // the caller's request id
+        int device;
+        int unit;
+        int batchSize; // requests served in the same interval
+        long long submitTime;
+        long long finishTime;
+    };
+
+    // Default Constructor
+    IOBatcher() {
+        numRequests_ = 0;
+        numBatches_ = 0;
+        totalServiceMicros_ = 0;
+        totalRequestedMicros_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(const DeviceRegistry& devices);
+    void submit(int id, int device, bool input, long long serviceMicros, long long now);
+    bool popCompleted(long long now, Completion& aCompletion);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    bool isBatched(int device) const;
+    bool hasPending() const;
+    long long nextEventTime() const;
+    int getNumBusy(int device) const;
+    long getNumRequests() const;
+    long getNumBatches() const;
+    long long getTotalServiceMicros() const;
+    long long getTotalRequestedMicros() const;
+
+private:
+    // Struct for a request in a batch
+    struct Request {
+        int id;
+        long long serviceMicros;
+        long long submitTime;
+    };
+
+    // Struct for a batch of requests to one device and direction
+    struct Batch {
+        long long closeTime; // end of the window
+        long long serviceMicros; // of the longest request
+        std::vector<Request> requests;
+    };
+
+    // Struct for one unit of a device
+    struct Unit {
+        bool busy;
+        long long finishTime;
+        Batch batch; // being served
+    };
+
+    // Struct for one device
+    struct Device {
+        long long window; // microseconds, -1 for no batching
+        bool open[2]; // a batch is open for input [0] / output [1]
+        Batch openBatch[2];
+        std::deque<Batch> closed; // waiting for a free unit
+        std::vector<Unit> units;
+    };
+
+    // PRIVATE DATA
+    std::vector<Device> devices_; // indexed like the device registry
+    std::deque<Completion> completed_; // in the order they finished
+    long numRequests_;
+    long numBatches_;
+    long long totalServiceMicros_; // unit time spent on batches
+    long long totalRequestedMicros_; // unit time the requests would take alone
+
+    // PRIVATE FUNCTIONS
+    void advance(long long now);
+    void startBatch(int device, int unit, const Batch& aBatch, long long startTime);
+    void finishUnit(int device, int unit);
+    static void saveBatch(CheckpointWriter& out, const Batch& aBatch);
+    static Batch restoreBatch(CheckpointReader& in);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets up the devices with a batch window, with every unit idle.
+ *
+ * @param[in]  devices  (const DeviceRegistry&) The devices
+ */
+void IOBatcher::initialize(const DeviceRegistry& devices) {
+    devices_.clear();
+    completed_.clear();
+
+    for (int i = 0; i < devices.size(); i++) {
+        const DeviceType& aType = devices.get(i);
+        Device aDevice;
+        Unit idleUnit;
+
+        idleUnit.busy = false;
+        idleUnit.finishTime = 0;
+        idleUnit.batch.closeTime = 0;
+        idleUnit.batch.serviceMicros = 0;
+
+        aDevice.window = (aType.batchWindow < 0) ? -1 : (aType.batchWindow * 1000LL);
+        aDevice.open[0] = false;
+        aDevice.open[1] = false;
+        aDevice.openBatch[0] = idleUnit.batch;
+        aDevice.openBatch[1] = idleUnit.batch;
+
+        if (aDevice.window >= 0) {
+            aDevice.units.assign(aType.quantity, idleUnit);
+        }
+
+        devices_.push_back(aDevice);
+    }
+}
+
+/**
+ * @brief      Adds a request to the open batch of its device and direction,
+ *             opening one if there is none.
+ *
+ * @param[in]  id             (int) The caller's request id
+ * @param[in]  device         (int) The registry index of a batched device
+ * @param[in]  input          (bool) true for input, false for output
+ * @param[in]  serviceMicros  (long long) The time the request takes alone
+ * @param[in]  now            (long long) The current time
+ */
+void IOBatcher::submit(int id, int device, bool input, long long serviceMicros, long long now) {
+    if (!isBatched(device)) {
+        // throw exception
+        throw std::logic_error("IOBatcher Class: Device Does Not Batch Requests");
+    }
+
+    advance(now);
+
+    Device& aDevice = devices_[device];
+    int direction = input ? 0 : 1;
+    Batch& aBatch = aDevice.openBatch[direction];
+
+    if (!aDevice.open[direction]) {
+        aDevice.open[direction] = true;
+        aBatch.closeTime = now + aDevice.window;
+        aBatch.serviceMicros = 0;
+        aBatch.requests.clear();
+    }
+
+    Request aRequest = {id, serviceMicros, now};
+    aBatch.requests.push_back(aRequest);
+
+    if (serviceMicros > aBatch.serviceMicros) {
+        aBatch.serviceMicros = serviceMicros;
+    }
+
+    numRequests_++;
+    totalRequestedMicros_ += serviceMicros;
+
+    // a zero window closes the batch straight away
+    advance(now);
+}
+
+/**
+ * @brief      Takes the earliest request that finished by now.
+ *
+ * @param[in]  now          (long long) The current time
+ * @param      aCompletion  (Completion&) The finished request
+ *
+ * @return     true if a request had finished.
+ */
+bool IOBatcher::popCompleted(long long now, Completion& aCompletion) {
+    advance(now);
+
+    if (completed_.empty()) {
+        return false;
+    }
+
+    aCompletion = completed_.front();
+    completed_.pop_front();
+
+    return true;
+}
+
+/**
+ * @brief      Runs the batch closes and unit finishes up to now, in time
+ *             order.
+ *
+ * @param[in]  now  (long long) The current time
+ */
+void IOBatcher::advance(long long now) {
+    while (true) {
+        // find the earliest event due by now
+        int eventDevice = -1;
+        int eventUnit = -1; // -1 for a batch close
+        int eventDirection = 0;
+        long long eventTime = now + 1;
+
+        for (unsigned int d = 0; d < devices_.size(); d++) {
+            Device& aDevice = devices_[d];
+
+            for (int direction = 0; direction < 2; direction++) {
+                if (aDevice.open[direction] && (aDevice.openBatch[direction].closeTime < eventTime)) {
+                    eventDevice = d;
+                    eventUnit = -1;
+                    eventDirection = direction;
+                    eventTime = aDevice.openBatch[direction].closeTime;
+                }
+            }
+
+            for (unsigned int u = 0; u < aDevice.units.size(); u++) {
+                if (aDevice.units[u].busy && (aDevice.units[u].finishTime < eventTime)) {
+                    eventDevice = d;
+                    eventUnit = u;
+                    eventTime = aDevice.units[u].finishTime;
+                }
+            }
+        }
+
+        if (eventDevice < 0) {
+            return;
+        }
+
+        Device& aDevice = devices_[eventDevice];
+
+        if (eventUnit >= 0) {
+            finishUnit(eventDevice, eventUnit);
+            continue;
+        }
+
+        // The window closed, serve the batch on a free unit or queue it
+        aDevice.open[eventDirection] = false;
+        aDevice.closed.push_back(aDevice.openBatch[eventDirection]);
+
+        for (unsigned int u = 0; u < aDevice.units.size(); u++) {
+            if (!aDevice.units[u].busy) {
+                Batch aBatch = aDevice.closed.front();
+                aDevice.closed.pop_front();
+                startBatch(eventDevice, u, aBatch, eventTime);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief      Starts serving a batch on an idle unit.
+ *
+ * @param[in]  device     (int) The device index
+ * @param[in]  unit       (int) The unit number
+ * @param[in]  aBatch     (const Batch&) The batch
+ * @param[in]  startTime  (long long) The time the unit starts
+ */
+void IOBatcher::startBatch(int device, int unit, const Batch& aBatch, long long startTime) {
+    Unit& aUnit = devices_[device].units[unit];
+
+    aUnit.busy = true;
+    aUnit.batch = aBatch;
+    aUnit.finishTime = startTime + aBatch.serviceMicros;
+
+    numBatches_++;
+    totalServiceMicros_ += aBatch.serviceMicros;
+}
+
+/**
+ * @brief      Completes every request of the batch on a unit, and starts the
+ *             next closed batch on it at the time it finished.
+ *
+ * @param[in]  device  (int) The device index
+ * @param[in]  unit    (int) The unit number
+ */
+void IOBatcher::finishUnit(int device, int unit) {
+    Device& aDevice = devices_[device];
+    Unit& aUnit = aDevice.units[unit];
+    const std::vector<Request>& requests = aUnit.batch.requests;
+
+    for (unsigned int i = 0; i < requests.size(); i++) {
+        Completion aCompletion = {requests[i].id, device, unit, (int)requests.size(),
+                                  requests[i].submitTime, aUnit.finishTime};
+        completed_.push_back(aCompletion);
+    }
+
+    aUnit.busy = false;
+
+    if (!aDevice.closed.empty()) {
+        Batch aBatch = aDevice.closed.front();
+        aDevice.closed.pop_front();
+        startBatch(device, unit, aBatch, aUnit.finishTime);
+    }
+}
+
+/**
+ * @brief      Checks whether a device batches its requests.
+ *
+ * @param[in]  device  (int) The registry index of the device
+ *
+ * @return     true if the device has a batch window.
+ */
+bool IOBatcher::isBatched(int device) const {
+    return (device >= 0) && (device < (int)devices_.size()) && (devices_[device].window >= 0);
+}
+
+/**
+ * @brief      Checks for requests that have not been popped.
+ *
+ * @return     true if a batch is open, waiting or being served, or a
+ *             request has finished.
+ */
+bool IOBatcher::hasPending() const {
+    if (!completed_.empty()) {
+        return true;
+    }
+
+    for (unsigned int d = 0; d < devices_.size(); d++) {
+        if (devices_[d].open[0] || devices_[d].open[1] || (!devices_[d].closed.empty())) {
+            return true;
+        }
+        for (unsigned int u = 0; u < devices_[d].units.size(); u++) {
+            if (devices_[d].units[u].busy) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief      Gets the time of the next batch close or unit finish. Only
+ *             valid if hasPending().
+ *
+ * @return     (long long) The time in microseconds, 0 if a finished request
+ *             is waiting to be popped.
+ */
+long long IOBatcher::nextEventTime() const {
+    if (!completed_.empty()) {
+        return 0;
+    }
+
+    long long next = -1;
+
+    for (unsigned int d = 0; d < devices_.size(); d++) {
+        const Device& aDevice = devices_[d];
+
+        for (int direction = 0; direction < 2; direction++) {
+            if (aDevice.open[direction] && ((next < 0) || (aDevice.openBatch[direction].closeTime < next))) {
+                next = aDevice.openBatch[direction].closeTime;
+            }
+        }
+        for (unsigned int u = 0; u < aDevice.units.size(); u++) {
+            if (aDevice.units[u].busy && ((next < 0) || (aDevice.units[u].finishTime < next))) {
+                next = aDevice.units[u].finishTime;
+            }
+        }
+    }
+
+    return next;
+}
+
+/**
+ * @brief      Gets the number of units of a device serving a batch.
+ *
+ * @param[in]  device  (int) Index of the device in the registry
+ *
+ * @return     (int) The number of busy units, 0 for a device that does not
+ *             batch.
+ */
+int IOBatcher::getNumBusy(int device) const {
+    int numBusy = 0;
+
+    for (unsigned int i = 0; i < devices_[device].units.size(); i++) {
+        numBusy += devices_[device].units[i].busy ? 1 : 0;
+    }
+
+    return numBusy;
+}
+
+long IOBatcher::getNumRequests() const {
+    return numRequests_;
+}
+
+long IOBatcher::getNumBatches() const {
+    return numBatches_;
+}
+
+/**
+ * @brief      Gets the unit time spent serving batches.
+ *
+ * @return     (long long) The time in microseconds.
+ */
+long long IOBatcher::getTotalServiceMicros() const {
+    return totalServiceMicros_;
+}
+
+/**
+ * @brief      Gets the unit time the requests would have taken one at a time.
+ *
+ * @return     (long long) The time in microseconds.
+ */
+long long IOBatcher::getTotalRequestedMicros() const {
+    return totalRequestedMicros_;
+}
+
+/**
+ * @brief      Writes the open, waiting and served batches, the finished
+ *             requests and the statistics to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void IOBatcher::save(CheckpointWriter& out) const {
+    out.putInt(devices_.size());
+    for (unsigned int d = 0; d < devices_.size(); d++) {
+        const Device& aDevice = devices_[d];
+
+        for (int direction = 0; direction < 2; direction++) {
+            out.putBool(aDevice.open[direction]);
+            saveBatch(out, aDevice.openBatch[direction]);
+        }
+
+        out.putInt(aDevice.closed.size());
+        for (unsigned int i = 0; i < aDevice.closed.size(); i++) {
+            saveBatch(out, aDevice.closed[i]);
+        }
+
+        out.putInt(aDevice.units.size());
+        for (unsigned int u = 0; u < aDevice.units.size(); u++) {
+            out.putBool(aDevice.units[u].busy);
+            out.putInt(aDevice.units[u].finishTime);
+            saveBatch(out, aDevice.units[u].batch);
+        }
+    }
+
+    out.putInt(completed_.size());
+    for (unsigned int i = 0; i < completed_.size(); i++) {
+        out.putInt(completed_[i].id);
+        out.putInt(completed_[i].device);
+        out.putInt(completed_[i].unit);
+        out.putInt(completed_[i].batchSize);
+        out.putInt(completed_[i].submitTime);
+        out.putInt(completed_[i].finishTime);
+    }
+
+    out.putInt(numRequests_);
+    out.putInt(numBatches_);
+    out.putInt(totalServiceMicros_);
+    out.putInt(totalRequestedMicros_);
+}
+
+/**
+ * @brief      Reads the batches from a checkpoint. The batch windows are
+ *             kept from initialize(), and units beyond those in the
+ *             checkpoint start idle.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void IOBatcher::restore(CheckpointReader& in) {
+    if (in.getInt() != (long long)devices_.size()) {
+        // throw exception
+        throw std::logic_error("IOBatcher Class: Checkpoint Has Different Devices");
+    }
+
+    for (unsigned int d = 0; d < devices_.size(); d++) {
+        Device& aDevice = devices_[d];
+
+        for (int direction = 0; direction < 2; direction++) {
+            aDevice.open[direction] = in.getBool();
+            aDevice.openBatch[direction] = restoreBatch(in);
+        }
+
+        aDevice.closed.clear();
+        for (long long i = in.getInt(); i > 0; i--) {
+            aDevice.closed.push_back(restoreBatch(in));
+        }
+
+        long long numUnits = in.getInt();
+        if (numUnits > (long long)aDevice.units.size()) {
+            // throw exception
+            throw std::logic_error("IOBatcher Class: Checkpoint Has More Units Than The Configuration");
+        }
+
+        for (long long u = 0; u < numUnits; u++) {
+            aDevice.units[u].busy = in.getBool();
+            aDevice.units[u].finishTime = in.getInt();
+            aDevice.units[u].batch = restoreBatch(in);
+        }
+    }
+
+    completed_.clear();
+    for (long long i = in.getInt(); i > 0; i--) {
+        Completion aCompletion;
+        aCompletion.id = in.getInt();
+        aCompletion.device = in.getInt();
+        aCompletion.unit = in.getInt();
+        aCompletion.batchSize = in.getInt();
+        aCompletion.submitTime = in.getInt();
+        aCompletion.finishTime = in.getInt();
+        completed_.push_back(aCompletion);
+    }
+
+    numRequests_ = in.getInt();
+    numBatches_ = in.getInt();
+    totalServiceMicros_ = in.getInt();
+    totalRequestedMicros_ = in.getInt();
+}
+
+void IOBatcher::saveBatch(CheckpointWriter& out, const Batch& aBatch) {
+    out.putInt(aBatch.closeTime);
+    out.putInt(aBatch.serviceMicros);
+    out.putInt(aBatch.requests.size());
+
+    for (unsigned int i = 0; i < aBatch.requests.size(); i++) {
+        out.putInt(aBatch.requests[i].id);
+        out.putInt(aBatch.requests[i].serviceMicros);
+        out.putInt(aBatch.requests[i].submitTime);
+    }
+}
+
+IOBatcher::Batch IOBatcher::restoreBatch(CheckpointReader& in) {
+    Batch aBatch;
+
+    aBatch.closeTime = in.getInt();
+    aBatch.serviceMicros = in.getInt();
+
+    for (long long i = in.getInt(); i > 0; i--) {
+        Request aRequest;
+        aRequest.id = in.getInt();
+        aRequest.serviceMicros = in.getInt();
+        aRequest.submitTime = in.getInt();
+        aBatch.requests.push_back(aRequest);
+    }
+
+    return aBatch;
+}
+
+#endif
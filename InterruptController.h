@@ -0,0 +1,99 @@
+/**
+ *  @file    InterruptController.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _INTERRUPT_CONTROLLER
+#define _INTERRUPT_CONTROLLER
+
+#include <atomic>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for the pending interrupts of the simulated CPU.
+ *
+ * Each interrupt source owns one bit of an atomic mask. A source raises its
+ * bit from any thread, and the dispatcher takes every pending bit at once
+ * with a single atomic exchange, so neither side takes a lock. Raising an
+ * interrupt that is already pending has no further effect.
+ */
+class InterruptController
+{
+public:
+    // Interrupt source bits
+    enum Interrupt {
+        TIMER = 1 << 0, // round robin quantum expired
+        ARRIVAL = 1 << 1, // processes arrived in the ready queue
+        IO_COMPLETION = 1 << 2, // queued I/O finished, processes are ready
+        PAGE_FAULT = 1 << 3 // a page was read from the hard drive
+    };
+
+    // Every source
+    static const unsigned int ALL = TIMER | ARRIVAL | IO_COMPLETION | PAGE_FAULT;
+
+    // Default Constructor
+    InterruptController() {
+        pending_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void raise(unsigned int interrupts);
+    unsigned int acknowledge(unsigned int interrupts);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    unsigned int getPending() const;
+
+private:
+    // PRIVATE DATA
+    std::atomic<unsigned int> pending_; // bits of the pending interrupts
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Marks interrupts as pending.
+ *
+ * @param[in]  interrupts  (unsigned int) The Interrupt bits
+ */
+void InterruptController::raise(unsigned int interrupts) {
+    pending_.fetch_or(interrupts);
+}
+
+/**
+ * @brief      Takes pending interrupts, clearing them.
+ *
+ * @param[in]  interrupts  (unsigned int) The Interrupt bits to take
+ *
+ * @return     (unsigned int) The bits that were pending.
+ */
+unsigned int InterruptController::acknowledge(unsigned int interrupts) {
+    return pending_.fetch_and(~interrupts) & interrupts;
+}
+
+/**
+ * @brief      Gets the pending interrupts without clearing them.
+ *
+ * @return     (unsigned int) The pending Interrupt bits.
+ */
+unsigned int InterruptController::getPending() const {
+    return pending_.load();
+}
+
+void InterruptController::save(CheckpointWriter& out) const {
+    out.putInt(pending_.load());
+}
+
+void InterruptController::restore(CheckpointReader& in) {
+    pending_ = in.getInt();
+}
+
+#endif
@@ -0,0 +1,398 @@
+/**
+ *  @file    LockStatistics.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _LOCK_STATISTICS
+#define _LOCK_STATISTICS
+
+#include <string>
+#include <ostream>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <chrono>
+#include <pthread.h>
+
+
+/**
+ * @brief      Class for the contention on one named lock: acquisitions, the
+ *             ones that had to wait, and histograms of the wait and hold
+ *             times.
+ *
+ * Histogram bucket i counts the times from 2^i to 2^(i+1) - 1 nanoseconds.
+ * The counters are atomic, so any number of threads may record at once.
+ * Nothing is recorded until the statistics are enabled, which must happen
+ * before the lock is used.
+ */
+class LockStatistics
+{
+public:
+    // Default Constructor
+    LockStatistics() {
+        enabled_ = false;
+        reset();
+    }
+
+    // PUBLIC FUNCTIONS
+    void enable(std::string name);
+    void recordAcquire(bool contended, long long waitNanos);
+    void recordHold(long long holdNanos);
+    void write(std::ostream& out) const;
+    static long long nowNanos();
+
+    // GETTER FUNCTIONS
+    bool isEnabled() const;
+    long getAcquisitions() const;
+    long getContended() const;
+    double getWaitPercentile(int percent) const;
+    double getHoldPercentile(int percent) const;
+
+private:
+    // Buckets of the histograms, up to about 18 minutes
+    static const int NUM_BUCKETS = 40;
+
+    // The counters are shared by the threads using the lock
+    LockStatistics(const LockStatistics&);
+    LockStatistics& operator=(const LockStatistics&);
+
+    // PRIVATE DATA
+    std::string name_;
+    bool enabled_;
+    std::atomic<long> acquisitions_;
+    std::atomic<long> contended_; // acquisitions that had to wait
+    std::atomic<long long> totalWait_; // nanoseconds
+    std::atomic<long long> minWait_;
+    std::atomic<long long> maxWait_;
+    std::atomic<long long> totalHold_;
+    std::atomic<long long> minHold_;
+    std::atomic<long long> maxHold_;
+    std::atomic<long> waitBuckets_[NUM_BUCKETS]; // contended acquisitions only
+    std::atomic<long> holdBuckets_[NUM_BUCKETS];
+
+    // PRIVATE FUNCTIONS
+    void reset();
+    static int bucketOf(long long nanos);
+    static void raiseMax(std::atomic<long long>& max, long long value);
+    static void lowerMin(std::atomic<long long>& min, long long value);
+    static double percentile(const std::atomic<long>* buckets, long count, int percent,
+                             long long min, long long max);
+    static void writeHistogram(std::ostream& out, const std::atomic<long>* buckets);
+};
+
+/**
+ * @brief      Class for a pthread mutex that records its contention in a
+ *             LockStatistics once enabled.
+ *
+ * A lock first tries the mutex; only if it is taken does the lock count as
+ * contended and time its wait. The hold time runs from acquiring to
+ * unlocking.
+ */
+class InstrumentedMutex
+{
+public:
+    // Default Constructor
+    InstrumentedMutex() {
+        pthread_mutex_init(&mutex_, NULL);
+        lockedAt_ = 0;
+    }
+
+    // Destructor
+    ~InstrumentedMutex() {
+        pthread_mutex_destroy(&mutex_);
+    }
+
+    // PUBLIC FUNCTIONS
+    void lock();
+    void unlock();
+
+    // GETTER FUNCTIONS
+    LockStatistics& getStatistics();
+    const LockStatistics& getStatistics() const;
+
+private:
+    // A mutex is not copied
+    InstrumentedMutex(const InstrumentedMutex&);
+    InstrumentedMutex& operator=(const InstrumentedMutex&);
+
+    // PRIVATE DATA
+    pthread_mutex_t mutex_;
+    long long lockedAt_; // nanoseconds, written by the holder only
+    LockStatistics statistics_;
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Starts recording, with every counter at zero.
+ *
+ * @param[in]  name  (std::string) The lock's name in the report
+ */
+void LockStatistics::enable(std::string name) {
+    name_ = name;
+    reset();
+    enabled_ = true;
+}
+
+void LockStatistics::reset() {
+    acquisitions_ = 0;
+    contended_ = 0;
+    totalWait_ = 0;
+    minWait_ = LLONG_MAX;
+    maxWait_ = 0;
+    totalHold_ = 0;
+    minHold_ = LLONG_MAX;
+    maxHold_ = 0;
+
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        waitBuckets_[i] = 0;
+        holdBuckets_[i] = 0;
+    }
+}
+
+bool LockStatistics::isEnabled() const {
+    return enabled_;
+}
+
+long LockStatistics::getAcquisitions() const {
+    return acquisitions_.load();
+}
+
+long LockStatistics::getContended() const {
+    return contended_.load();
+}
+
+/**
+ * @brief      Gets a time stamp for measuring waits and holds.
+ *
+ * @return     (long long) Nanoseconds on the steady clock.
+ */
+long long LockStatistics::nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief      Records one acquisition.
+ *
+ * @param[in]  contended  (bool) true if the lock had to be waited for
+ * @param[in]  waitNanos  (long long) The wait, 0 if not contended
+ */
+void LockStatistics::recordAcquire(bool contended, long long waitNanos) {
+    acquisitions_.fetch_add(1, std::memory_order_relaxed);
+
+    if (contended) {
+        contended_.fetch_add(1, std::memory_order_relaxed);
+        totalWait_.fetch_add(waitNanos, std::memory_order_relaxed);
+        waitBuckets_[bucketOf(waitNanos)].fetch_add(1, std::memory_order_relaxed);
+        lowerMin(minWait_, waitNanos);
+        raiseMax(maxWait_, waitNanos);
+    }
+}
+
+/**
+ * @brief      Records the time one acquisition held the lock.
+ *
+ * @param[in]  holdNanos  (long long) The hold time
+ */
+void LockStatistics::recordHold(long long holdNanos) {
+    totalHold_.fetch_add(holdNanos, std::memory_order_relaxed);
+    holdBuckets_[bucketOf(holdNanos)].fetch_add(1, std::memory_order_relaxed);
+    lowerMin(minHold_, holdNanos);
+    raiseMax(maxHold_, holdNanos);
+}
+
+/**
+ * @brief      Gets the histogram bucket of a time.
+ *
+ * @param[in]  nanos  (long long) The time
+ *
+ * @return     (int) The bucket, floor(log2(nanos)), 0 for under 2 ns.
+ */
+int LockStatistics::bucketOf(long long nanos) {
+    int bucket = 0;
+
+    while ((nanos > 1) && (bucket < (NUM_BUCKETS - 1))) {
+        nanos >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void LockStatistics::raiseMax(std::atomic<long long>& max, long long value) {
+    long long current = max.load(std::memory_order_relaxed);
+
+    // on failure current is reloaded and compared again
+    while ((value > current) &&
+           (!max.compare_exchange_weak(current, value, std::memory_order_relaxed))) {
+    }
+}
+
+void LockStatistics::lowerMin(std::atomic<long long>& min, long long value) {
+    long long current = min.load(std::memory_order_relaxed);
+
+    // on failure current is reloaded and compared again
+    while ((value < current) &&
+           (!min.compare_exchange_weak(current, value, std::memory_order_relaxed))) {
+    }
+}
+
+/**
+ * @brief      Gets the wait time percentile of the contended acquisitions.
+ *
+ * @param[in]  percent  (int) The percentile
+ *
+ * @return     (double) Nanoseconds, estimated from the histogram.
+ */
+double LockStatistics::getWaitPercentile(int percent) const {
+    return percentile(waitBuckets_, contended_.load(), percent, minWait_.load(), maxWait_.load());
+}
+
+/**
+ * @brief      Gets the hold time percentile of the acquisitions.
+ *
+ * @param[in]  percent  (int) The percentile
+ *
+ * @return     (double) Nanoseconds, estimated from the histogram.
+ */
+double LockStatistics::getHoldPercentile(int percent) const {
+    return percentile(holdBuckets_, acquisitions_.load(), percent, minHold_.load(), maxHold_.load());
+}
+
+/**
+ * @brief      Gets a percentile of a histogram, interpolating linearly
+ *             between the bounds of the bucket that holds it as if its times
+ *             were spread evenly. The shortest and longest times bound the
+ *             first and last buckets.
+ *
+ * @param[in]  buckets  (const std::atomic<long>*) The histogram
+ * @param[in]  count    (long) The times in the histogram
+ * @param[in]  percent  (int) The percentile
+ * @param[in]  min      (long long) The shortest time in the histogram
+ * @param[in]  max      (long long) The longest time in the histogram
+ *
+ * @return     (double) Nanoseconds, 0 for an empty histogram.
+ */
+double LockStatistics::percentile(const std::atomic<long>* buckets, long count, int percent,
+                                  long long min, long long max) {
+    // nearest rank
+    long rank = (count * percent + 99) / 100;
+    long seen = 0;
+
+    for (int i = 0; (i < NUM_BUCKETS) && (rank > 0); i++) {
+        long inBucket = buckets[i].load();
+
+        if (seen + inBucket >= rank) {
+            double low = std::max((i == 0) ? 0 : (double)(1LL << i), (double)min);
+            double high = std::min((double)(2LL << i), (double)max);
+
+            return low + (high - low) * (rank - seen) / inBucket;
+        }
+
+        seen += inBucket;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      Writes the non-empty buckets of a histogram on one line.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the histogram.
+ * @param[in]  buckets  (const std::atomic<long>*) The histogram
+ */
+void LockStatistics::writeHistogram(std::ostream& out, const std::atomic<long>* buckets) {
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        long count = buckets[i].load();
+
+        if (count > 0) {
+            out << " <" << (2LL << i) << ":" << count;
+        }
+    }
+    out << std::endl;
+}
+
+/**
+ * @brief      Writes the counts, the mean, p50, p99 and max wait and hold
+ *             times in microseconds, and the histograms in nanoseconds. The
+ *             percentiles are interpolated within their histogram buckets.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the statistics.
+ */
+void LockStatistics::write(std::ostream& out) const {
+    long acquisitions = acquisitions_.load();
+    long contended = contended_.load();
+
+    out << "    " << name_ << ": " << acquisitions << " acquisitions, "
+        << contended << " contended (" << std::fixed << std::setprecision(3)
+        << ((acquisitions > 0) ? (100.0 * contended / acquisitions) : 0) << " percent)" << std::endl;
+
+    out << "        wait {usec}: mean "
+        << ((contended > 0) ? (totalWait_.load() / 1e3 / contended) : 0)
+        << ", p50 " << (getWaitPercentile(50) / 1e3)
+        << ", p99 " << (getWaitPercentile(99) / 1e3)
+        << ", max " << (maxWait_.load() / 1e3) << std::endl;
+
+    out << "        hold {usec}: mean "
+        << ((acquisitions > 0) ? (totalHold_.load() / 1e3 / acquisitions) : 0)
+        << ", p50 " << (getHoldPercentile(50) / 1e3)
+        << ", p99 " << (getHoldPercentile(99) / 1e3)
+        << ", max " << (maxHold_.load() / 1e3) << std::endl;
+
+    out << "        wait histogram {nsec}:";
+    writeHistogram(out, waitBuckets_);
+    out << "        hold histogram {nsec}:";
+    writeHistogram(out, holdBuckets_);
+}
+
+/**
+ * @brief      Locks the mutex, recording the acquisition if enabled.
+ */
+void InstrumentedMutex::lock() {
+    if (!statistics_.isEnabled()) {
+        pthread_mutex_lock(&mutex_);
+        return;
+    }
+
+    bool contended = (pthread_mutex_trylock(&mutex_) != 0);
+    long long waitNanos = 0;
+
+    if (contended) {
+        long long waitStart = LockStatistics::nowNanos();
+        pthread_mutex_lock(&mutex_);
+        waitNanos = LockStatistics::nowNanos() - waitStart;
+    }
+
+    lockedAt_ = LockStatistics::nowNanos();
+    statistics_.recordAcquire(contended, waitNanos);
+}
+
+/**
+ * @brief      Unlocks the mutex, recording the hold time if enabled.
+ */
+void InstrumentedMutex::unlock() {
+    if (statistics_.isEnabled()) {
+        statistics_.recordHold(LockStatistics::nowNanos() - lockedAt_);
+    }
+
+    pthread_mutex_unlock(&mutex_);
+}
+
+LockStatistics& InstrumentedMutex::getStatistics() {
+    return statistics_;
+}
+
+const LockStatistics& InstrumentedMutex::getStatistics() const {
+    return statistics_;
+}
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ *  @file    MdfGen.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Synthetic meta data file generator
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "WorkloadGenerator.h"
+
+//FUNCTION PROTOTYPES
+void printUsage(std::ostream& out);
+
+/**
+ * @brief      Writes a synthetic meta data file (and optionally an arrival
+ *             schedule) built from the options on the command line.
+ *
+ * @param[in]  argc  (int) The number of command line arguments
+ * @param      argv  (char const* []) Array of command line arguments
+ *
+ * @return     (int) 0 on success, 1 on a usage error, invalid option or
+ *             unwritable file
+ */
+int main(int argc, char const *argv[])
+{
+    WorkloadGenerator generator;
+    std::string mdfFilePath;
+    std::string arrivalFilePath;
+
+    try {
+        // every option takes exactly one value
+        for (int i = 1; i < argc; i += 2) {
+            std::string option = argv[i];
+
+            if ((option == "-h") || (option == "--help")) {
+                printUsage(std::cout);
+                return 0;
+            }
+            if ((i + 1) >= argc) {
+                std::cerr << "Missing value for " << option << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            }
+
+            std::string value = argv[i + 1];
+
+            if (option == "--processes") generator.setNumProcesses(atol(value.c_str()));
+            else if (option == "--seed") generator.setSeed(strtoull(value.c_str(), NULL, 10));
+            else if (option == "--ops") generator.setOpsDistribution(value);
+            else if (option == "--run-cycles") generator.setRunCycles(value);
+            else if (option == "--io-cycles") generator.setIOCycles(value);
+            else if (option == "--memory-cycles") generator.setMemoryCycles(value);
+            else if (option == "--mix") generator.setOperationMix(value);
+            else if (option == "--inputs") generator.setInputMix(value);
+            else if (option == "--outputs") generator.setOutputMix(value);
+            else if (option == "--memory") generator.setMemoryMix(value);
+            else if (option == "--per-line") generator.setCommandsPerLine(atoi(value.c_str()));
+            else if (option == "--interarrival") generator.setInterArrival(value);
+            else if (option == "--arrivals") arrivalFilePath = value;
+            else if (option == "--out") mdfFilePath = value;
+            else {
+                std::cerr << "Unknown option " << option << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            }
+        }
+
+        if (mdfFilePath.empty()) {
+            generator.writeMDF(std::cout);
+        }
+        else {
+            std::ofstream outToFile(mdfFilePath.c_str());
+            if (!outToFile) {
+                std::cerr << "Could not open " << mdfFilePath << std::endl;
+                return 1;
+            }
+            generator.writeMDF(outToFile);
+            outToFile.close();
+        }
+
+        if (!arrivalFilePath.empty()) {
+            std::ofstream outToFile(arrivalFilePath.c_str());
+            if (!outToFile) {
+                std::cerr << "Could not open " << arrivalFilePath << std::endl;
+                return 1;
+            }
+            generator.writeArrivals(outToFile);
+            outToFile.close();
+        }
+    }
+    catch (const std::logic_error& error) {
+        std::cerr << error.what() << std::endl;
+        printUsage(std::cerr);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+/**
+ * @brief      Prints the command line options.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the usage.
+ */
+void printUsage(std::ostream& out) {
+    out << "Usage: ./MdfGen [options]" << std::endl
+        << "  --processes N        number of processes (default 10)" << std::endl
+        << "  --seed S             random seed (default 1)" << std::endl
+        << "  --ops DIST           operations per process (default uniform:1:8)" << std::endl
+        << "  --run-cycles DIST    P{run} cycles (default uniform:1:20)" << std::endl
+        << "  --io-cycles DIST     I/O cycles (default uniform:1:20)" << std::endl
+        << "  --memory-cycles DIST M cycles (default uniform:1:4)" << std::endl
+        << "  --mix MIX            operation mix over run, input, output, memory" << std::endl
+        << "                       (default run=4,input=2,output=2,memory=2)" << std::endl
+        << "  --inputs MIX         input devices (default hard drive=2,keyboard=1)" << std::endl
+        << "  --outputs MIX        output devices (default hard drive=2,monitor=1,projector=1)" << std::endl
+        << "  --memory MIX         memory operations (default allocate=1,block=1)" << std::endl
+        << "  --per-line N         commands per line (default 5)" << std::endl
+        << "  --out FILE           meta data file (default standard output)" << std::endl
+        << "  --arrivals FILE      also write an arrival schedule" << std::endl
+        << "  --interarrival DIST  gap between arrivals in msec (default exp:100)" << std::endl
+        << std::endl
+        << "DIST is fixed:N, uniform:LO:HI, exp:MEAN, pareto:ALPHA:MIN or pareto:ALPHA:MIN:MAX" << std::endl
+        << "MIX is name=weight,name=weight,..." << std::endl;
+}
@@ -11,6 +11,8 @@
 
 #include <string>
 
+#include "Checkpoint.h"
+
 /**
  * @brief      Class for the meta data command code, command descriptor, 
  *             the number of cycles required by the command, and the 
@@ -19,6 +21,9 @@
 class MetaCommand
 {
 public:
+    // Access pattern enum for the working set of a processing action
+    enum Pattern {SEQUENTIAL, RANDOM};
+
     /**
      * @brief      Default constructor sets code to '.', descriptor to one 
      *             empty space, cycles to zero, and time to zero.
@@ -28,6 +33,10 @@ public:
         descriptor_ = " ";
         cycles_ = 0;
         time_ = 0;
+        deviceIndex_ = -1;
+        track_ = -1;
+        workingSet_ = 0;
+        accessPattern_ = SEQUENTIAL;
     }
 
     // OVERLOADED CONSTRUCTOR
@@ -38,6 +47,20 @@ public:
     std::string getDescriptor() const;
     int getCycles() const;
     int getTime() const;
+    int getTimeOfCycles(int cycles) const;
+    int getDeviceIndex() const;
+    int getTrack() const;
+    int getWorkingSet() const;
+    Pattern getAccessPattern() const;
+
+    // SETTER FUNCTIONS
+    void setDeviceIndex(int deviceIndex);
+    void setTrack(int track);
+    void setWorkingSet(int kbytes, Pattern pattern);
+
+    // PUBLIC FUNCTIONS
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
 
 private:
     // PRIVATE DATA
@@ -45,6 +68,10 @@ private:
     std::string descriptor_;
     int cycles_;
     int time_;
+    int deviceIndex_; // index of the I/O device in the registry, -1 if none
+    int track_; // hard drive track, -1 if not given
+    int workingSet_; // kbytes a processing action accesses, 0 if not given
+    Pattern accessPattern_;
 };
 
 //******************************************************************************
@@ -65,6 +92,10 @@ MetaCommand::MetaCommand(char code, std::string descriptor, int cycles, int time
     descriptor_ = descriptor;
     cycles_ = cycles;
     time_ = time;
+    deviceIndex_ = -1;
+    track_ = -1;
+    workingSet_ = 0;
+    accessPattern_ = SEQUENTIAL;
 }
 
 /**
@@ -104,4 +135,112 @@ int MetaCommand::getTime() const {
     return time_;
 }
 
+/**
+ * @brief      Gets the time of some of the cycles.
+ *
+ * @param[in]  cycles  (int) The number of cycles
+ *
+ * @return     (int) The time of that many cycles.
+ */
+int MetaCommand::getTimeOfCycles(int cycles) const {
+    if (cycles_ == 0) {
+        return 0;
+    }
+
+    return (time_ / cycles_) * cycles;
+}
+
+/**
+ * @brief      Gets the index of the I/O device in the device registry.
+ *
+ * @return     (int) The device index, -1 if not an I/O command.
+ */
+int MetaCommand::getDeviceIndex() const {
+    return deviceIndex_;
+}
+
+/**
+ * @brief      Sets the index of the I/O device in the device registry.
+ *
+ * @param[in]  deviceIndex  (int) The device index
+ */
+void MetaCommand::setDeviceIndex(int deviceIndex) {
+    deviceIndex_ = deviceIndex;
+}
+
+/**
+ * @brief      Gets the hard drive track of the operation.
+ *
+ * @return     (int) The track, -1 if not given.
+ */
+int MetaCommand::getTrack() const {
+    return track_;
+}
+
+/**
+ * @brief      Sets the hard drive track of the operation.
+ *
+ * @param[in]  track  (int) The track
+ */
+void MetaCommand::setTrack(int track) {
+    track_ = track;
+}
+
+/**
+ * @brief      Gets the working set of a processing action.
+ *
+ * @return     (int) The kbytes accessed by every cycle, 0 if not given.
+ */
+int MetaCommand::getWorkingSet() const {
+    return workingSet_;
+}
+
+MetaCommand::Pattern MetaCommand::getAccessPattern() const {
+    return accessPattern_;
+}
+
+/**
+ * @brief      Sets the working set of a processing action.
+ *
+ * @param[in]  kbytes   (int) The kbytes accessed by every cycle
+ * @param[in]  pattern  (Pattern) SEQUENTIAL walks the working set a line at
+ *                      a time, RANDOM picks lines uniformly
+ */
+void MetaCommand::setWorkingSet(int kbytes, Pattern pattern) {
+    workingSet_ = kbytes;
+    accessPattern_ = pattern;
+}
+
+/**
+ * @brief      Writes the command to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void MetaCommand::save(CheckpointWriter& out) const {
+    out.putInt(code_);
+    out.putString(descriptor_);
+    out.putInt(cycles_);
+    out.putInt(time_);
+    out.putInt(deviceIndex_);
+    out.putInt(track_);
+    out.putInt(workingSet_);
+    out.putInt(accessPattern_);
+}
+
+/**
+ * @brief      Reads the command from a checkpoint.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void MetaCommand::restore(CheckpointReader& in) {
+    code_ = (char)in.getInt();
+    descriptor_ = in.getString();
+    cycles_ = in.getInt();
+    time_ = in.getInt();
+    deviceIndex_ = in.getInt();
+    track_ = in.getInt();
+    workingSet_ = in.getInt();
+    accessPattern_ = (Pattern)in.getInt();
+}
+
 #endif
\ No newline at end of file
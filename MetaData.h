@@ -16,20 +16,18 @@
 #include <stdexcept>
 
 #include "Configuration.h"
-#include "ReadyQueue.h"
-// Process.h included with ReadyQueue.h
+#include "Process.h"
 // MetaCommand.h included with Process.h
 // CycleTime.h included with Configuration.h
 
 
 // Arrays of keys and descriptions for cycle time calculations in handler()
-const std::string DESC_ARR[] = {"run", "hard drive", "keyboard", "scanner", 
-                               "monitor", "projector", "block", "allocate"};
+// I/O descriptors are looked up in the device registry instead
+const std::string DESC_ARR[] = {"run", "block", "allocate"};
 
-const std::string KEY_ARR[] = {"processor", "hardDrive", "keyboard", "scanner", 
-                              "monitor", "projector", "memory", "memory"};
+const std::string KEY_ARR[] = {"processor", "memory", "memory"};
 
-const int NUM_DESC = 8; // the number of descriptions in DESC_ARR
+const int NUM_DESC = 3; // the number of descriptions in DESC_ARR
 
 
 /**
@@ -45,7 +43,7 @@ public:
     }
 
     // PUBLIC FUNCTIONS
-    void parseMDF(std::string metaDataFilePath, ReadyQueue& readyQ);
+    void parseMDF(std::string metaDataFilePath, std::vector<Process>& processes);
 
     // Default Constructor
     MetaData() {
@@ -64,7 +62,7 @@ private:
     int ioOpCountForProcess_;
 
     // PRIVATE FUNCTIONS
-    void parseFullLine(std::string fullString, ReadyQueue& readyQ);
+    void parseFullLine(std::string fullString, std::vector<Process>& processes);
     void handleCodeDescErrors(char codeChar, std::string descriptor);
     bool checkSpecialCommands(char codeChar, std::string descriptor);
 
@@ -72,7 +70,12 @@ private:
     void handler(std::string code, 
                  std::string descriptor, 
                  std::string cycles, 
-                 ReadyQueue& readyQ);
+                 std::string arrival,
+                 std::string deadline,
+                 std::string track,
+                 std::string workingSet,
+                 std::string pattern,
+                 std::vector<Process>& processes);
 };
 
 //******************************************************************************
@@ -83,10 +86,15 @@ private:
  * @brief      Public function used to parse the meta data file (path to meta
  *             data file provided in the configuration file)
  *
+ * Processes are appended to the vector in the order they appear in the file.
+ * Arrival of the processes into the ready queue is left to the caller.
+ *
  * @param[in]  metaDataFilePath  (std::string) The meta data file path
- * @param[in]  readyQ  (ReadyQueue&) Reference to the ready queue
+ * @param[in]  processes  (std::vector<Process>&) Reference to the parsed processes
  */
-void MetaData::parseMDF(std::string metaDataFilePath, ReadyQueue& readyQ) {
+void MetaData::parseMDF(std::string metaDataFilePath, std::vector<Process>& processes) {
+    ScopedPhaseTimer timer("Parse meta data");
+
     std::ifstream inputFile(metaDataFilePath.c_str());
 
     if (inputFile.fail()) {
@@ -105,7 +113,7 @@ void MetaData::parseMDF(std::string metaDataFilePath, ReadyQueue& readyQ) {
 
     // Read the rest of the file
     while (inputFile) {
-        parseFullLine(fullLine, readyQ);
+        parseFullLine(fullLine, processes);
         std::getline(inputFile, fullLine);
     }
 
@@ -119,9 +127,9 @@ void MetaData::parseMDF(std::string metaDataFilePath, ReadyQueue& readyQ) {
  *             file, then calls the handler() function to handle the command.
  *
  * @param[in]  fullLine  (std::string) raw string possibly containing multiple commands
- * @param[in]  readyQ  (ReadyQueue&) Reference to the ready queue
+ * @param[in]  processes  (std::vector<Process>&) Reference to the parsed processes
  */
-void MetaData::parseFullLine(std::string fullLine, ReadyQueue& readyQ) {
+void MetaData::parseFullLine(std::string fullLine, std::vector<Process>& processes) {
     // Check for Start or End commands which don't have delimiters
     /* Regex:
             * means character can occur zero or more times
@@ -147,16 +155,26 @@ void MetaData::parseFullLine(std::string fullLine, ReadyQueue& readyQ) {
             ([a-z ]+) means that one or more lowercase alpha chars or spaces are requires
                 and held as a sub_match
             ([0-9]+) means that one or more digits are required and held as sub_match
+            (?:@([0-9]+))? means an optional @ followed by digits, the digits are
+                held as a sub_match (empty if not present)
+            (?:!([0-9]+))? means an optional ! followed by digits, the deadline
+                after arrival, held as a sub_match (empty if not present)
+            (?:#([0-9]+))? means an optional # followed by digits, the hard drive
+                track, held as a sub_match (empty if not present)
+            (?:%([0-9]+)([sr])?)? means an optional % followed by digits, the
+                working set in kbytes, and an optional access pattern letter,
+                each held as a sub_match (empty if not present)
             ; means that semicolon is required
     */
-    std::regex cmdStringRE("\\b[\\s]*(S|A|P|I|O|M)\\{([a-z ]+)\\}([0-9]+);");
+    std::regex cmdStringRE("\\b[\\s]*(S|A|P|I|O|M)\\{([a-z ]+)\\}([0-9]+)(?:@([0-9]+))?(?:!([0-9]+))?(?:#([0-9]+))?(?:%([0-9]+)([sr])?)?;");
 
     // regex iterators pointing to beginning and end of fullLine to iterate over
     // the valid cmdStringRE matches
     std::regex_iterator<std::string::iterator> rit (fullLine.begin(), fullLine.end(), cmdStringRE);
     std::regex_iterator<std::string::iterator> rend;
     while ((rit!=rend) && (!sFinishFound_)) {
-        handler(rit->str(1), rit->str(2), rit->str(3), readyQ);
+        handler(rit->str(1), rit->str(2), rit->str(3), rit->str(4), rit->str(5),
+                rit->str(6), rit->str(7), rit->str(8), processes);
 
         // increment iterator
         ++rit;
@@ -176,12 +194,27 @@ void MetaData::parseFullLine(std::string fullLine, ReadyQueue& readyQ) {
  * @param[in]  code        (std::string) The raw string of the code value
  * @param[in]  descriptor  (std::string) The raw string of the descriptor value
  * @param[in]  cycles      (std::string) The raw string of the cycles value
- * @param[in]  readyQ      (ReadyQueue&) Reference to the ready queue
+ * @param[in]  arrival     (std::string) The raw string of the arrival time in
+ *                         milliseconds, empty if not given
+ * @param[in]  deadline    (std::string) The raw string of the deadline in
+ *                         milliseconds after arrival, empty if not given
+ * @param[in]  track       (std::string) The raw string of the hard drive track,
+ *                         empty if not given
+ * @param[in]  workingSet  (std::string) The raw string of the working set in
+ *                         kbytes, empty if not given
+ * @param[in]  pattern     (std::string) "s" for sequential or "r" for random
+ *                         access to the working set, empty if not given
+ * @param[in]  processes   (std::vector<Process>&) Reference to the parsed processes
  */
 void MetaData::handler(std::string code, 
                        std::string descriptor, 
                        std::string cycles, 
-                       ReadyQueue& readyQ) {
+                       std::string arrival,
+                       std::string deadline,
+                       std::string track,
+                       std::string workingSet,
+                       std::string pattern,
+                       std::vector<Process>& processes) {
 
 
     char codeChar = code.at(0); // convert code to char
@@ -195,6 +228,38 @@ void MetaData::handler(std::string code,
     // Call function to handle errors of code descroptor mismatch
     handleCodeDescErrors(codeChar, descriptor);
 
+    // The arrival annotation only belongs on A{begin}
+    if ((!arrival.empty()) && ((codeChar != 'A') || (descriptor != "begin"))) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Arrival Time Only Allowed On A{begin}");
+    }
+
+    // The deadline annotation only belongs on A{begin}
+    if ((!deadline.empty()) && ((codeChar != 'A') || (descriptor != "begin"))) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Deadline Only Allowed On A{begin}");
+    }
+
+    // The track annotation only belongs on hard drive I/O
+    if ((!track.empty()) && (((codeChar != 'I') && (codeChar != 'O')) || (descriptor != "hard drive"))) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Track Only Allowed On Hard Drive I/O");
+    }
+    if ((!track.empty()) && (atoi(track.c_str()) >= configObj_.getDiskTracks())) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Track Is Beyond The Last Track");
+    }
+
+    // The working set annotation only belongs on P{run}
+    if ((!workingSet.empty()) && ((codeChar != 'P') || (descriptor != "run"))) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Working Set Only Allowed On P{run}");
+    }
+    if ((!workingSet.empty()) && (atoi(workingSet.c_str()) < 1)) {
+        // throw exception
+        throw std::logic_error("MetaData Class: Working Set is Less Than One");
+    }
+
     // Check for Special Command errors and return circumstances
     if (checkSpecialCommands(codeChar, descriptor)) {
         return;
@@ -209,10 +274,21 @@ void MetaData::handler(std::string code,
 
         // Overwrite old process object with new one
         processObj_ = tempProcessObj;
+
+        // Store the arrival time in microseconds
+        if (!arrival.empty()) {
+            processObj_.setArrivalTime(atoll(arrival.c_str()) * 1000);
+        }
+
+        // Store the deadline, relative to the arrival
+        if (!deadline.empty()) {
+            processObj_.setRelativeDeadline(atoi(deadline.c_str()));
+        }
     }
 
     // Calculate time for cycles
     int tempTime = 0;
+    int deviceIndex = -1;
     // DESC_ARR[] and KEY_ARR[] are global constants at top of file
     for (int index = 0; index < NUM_DESC; index++) {
         if (descriptor == DESC_ARR[index]) {
@@ -221,11 +297,25 @@ void MetaData::handler(std::string code,
         }
     }
 
+    // I/O descriptors name a device, checked by handleCodeDescErrors()
+    if ((codeChar == 'I') || (codeChar == 'O')) {
+        deviceIndex = configObj_.getDevices().find(descriptor);
+        tempTime = (configObj_.getDevices().get(deviceIndex).cycleTime * numCycles);
+    }
+
     // add operation time to total process time remaining
     processObj_.addProcessTimeRemain(tempTime);
 
     // Create MetaCommand object and fill with info
     MetaCommand tempMetaCmdObj(codeChar, descriptor, numCycles, tempTime);
+    tempMetaCmdObj.setDeviceIndex(deviceIndex);
+    if (!track.empty()) {
+        tempMetaCmdObj.setTrack(atoi(track.c_str()));
+    }
+    if (!workingSet.empty()) {
+        tempMetaCmdObj.setWorkingSet(atoi(workingSet.c_str()),
+                                     (pattern == "r") ? MetaCommand::RANDOM : MetaCommand::SEQUENTIAL);
+    }
 
     // Check for I/O operation
     if ((codeChar == 'I') || (codeChar == 'O')) {
@@ -243,17 +333,8 @@ void MetaData::handler(std::string code,
         // Add number of I/O ops to the process object
         processObj_.setNumIOops(ioOpCountForProcess_);
 
-        // set process number
-        processObj_.setProcessNumber(readyQ.getProcessArrivalIndx());
-
-        // increment process arrival index in ready queue
-        readyQ.incrementProcessArrivalIndx();
-
-        // Add process to ready queue
-        readyQ.insertProcess(processObj_);
-
-        // // Sort the ready queue
-        // readyQ.sortReadyQueue();
+        // Add process to the parsed processes
+        processes.push_back(processObj_);
     }
 
     // increment current overall read operation index
@@ -297,19 +378,30 @@ void MetaData::handleCodeDescErrors(char codeChar, std::string descriptor) {
         }
         case 'I':
         {
-            if ((descriptor != "hard drive") && (descriptor != "keyboard") && (descriptor != "scanner")) {
-                std::cout << descriptor << std::endl;
+            int deviceIndex = configObj_.getDevices().find(descriptor);
+
+            if ((deviceIndex < 0) || !configObj_.getDevices().get(deviceIndex).input) {
                 // throw exception
                 throw std::logic_error("MetaData Class: Incorrect Descriptor for 'I' Command");
             }
+            if (configObj_.getDevices().get(deviceIndex).cycleTime < 0) {
+                // throw exception
+                throw std::logic_error("MetaData Class: Device Has No Cycle Time");
+            }
             break;
         }
         case 'O':
         {
-            if ((descriptor != "hard drive") && (descriptor != "monitor") && (descriptor != "projector")) {
+            int deviceIndex = configObj_.getDevices().find(descriptor);
+
+            if ((deviceIndex < 0) || !configObj_.getDevices().get(deviceIndex).output) {
                 // throw exception
                 throw std::logic_error("MetaData Class: Incorrect Descriptor for 'O' Command");
             }
+            if (configObj_.getDevices().get(deviceIndex).cycleTime < 0) {
+                // throw exception
+                throw std::logic_error("MetaData Class: Device Has No Cycle Time");
+            }
             break;
         }
         case 'M':
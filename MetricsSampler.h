@@ -0,0 +1,299 @@
+/**
+ *  @file    MetricsSampler.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _METRICS_SAMPLER
+#define _METRICS_SAMPLER
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "DeviceRegistry.h"
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for a time series of the simulation's state, sampled
+ *             every interval of simulated time.
+ *
+ * The runner offers its state after every step of the clock. The state
+ * held for the whole step, so it is the sample of every interval boundary
+ * the step passed. The series is written as comma separated values, or in
+ * the Prometheus text format with a time stamp on every sample, which the
+ * Prometheus tools can backfill.
+ */
+class MetricsSampler
+{
+public:
+    // Output format enum
+    enum Format {CSV, PROMETHEUS};
+
+    // Struct for the state at one sample
+    struct Sample {
+        long long time; // microseconds
+        int readyQueue; // processes in the ready queue
+        int waiting; // processes waiting for memory or queued I/O
+        long memoryInUse; // kbytes
+        long completed; // processes finished so far
+        std::vector<int> busyUnits; // indexed like the device registry
+    };
+
+    // Default Constructor
+    MetricsSampler() {
+        intervalMicros_ = 0;
+        nextSample_ = 0;
+        format_ = CSV;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(long long intervalMicros, Format format, const DeviceRegistry& devices);
+    void record(const Sample& state, long long now);
+    void write(std::ostream& out) const;
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    bool isEnabled() const;
+    bool isDue(long long now) const;
+    int getNumSamples() const;
+
+private:
+    // PRIVATE DATA
+    long long intervalMicros_; // 0 for no sampling
+    long long nextSample_; // time of the next interval boundary
+    Format format_;
+    std::vector<std::string> deviceNames_; // indexed like the device registry
+    std::vector<Sample> samples_;
+
+    // PRIVATE FUNCTIONS
+    void writeCSV(std::ostream& out) const;
+    void writePrometheus(std::ostream& out) const;
+    void writeFamily(std::ostream& out, std::string name, std::string type,
+                     std::string help, int field) const;
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets the interval and the devices, with no samples taken.
+ *
+ * @param[in]  intervalMicros  (long long) Simulated time between samples, 0
+ *                             for no sampling
+ * @param[in]  format          (Format) The output format
+ * @param[in]  devices         (const DeviceRegistry&) The devices
+ */
+void MetricsSampler::initialize(long long intervalMicros, Format format, const DeviceRegistry& devices) {
+    if (intervalMicros < 0) {
+        // throw exception
+        throw std::logic_error("MetricsSampler Class: Sample Interval is Less Than Zero");
+    }
+
+    intervalMicros_ = intervalMicros;
+    nextSample_ = 0;
+    format_ = format;
+    samples_.clear();
+
+    deviceNames_.clear();
+    for (int i = 0; i < devices.size(); i++) {
+        deviceNames_.push_back(devices.get(i).name);
+    }
+}
+
+bool MetricsSampler::isEnabled() const {
+    return intervalMicros_ > 0;
+}
+
+/**
+ * @brief      Checks whether the clock has reached an interval boundary that
+ *             has not been sampled.
+ *
+ * @param[in]  now   (long long) The current time in microseconds
+ *
+ * @return     true if record would take a sample.
+ */
+bool MetricsSampler::isDue(long long now) const {
+    return (intervalMicros_ > 0) && (nextSample_ <= now);
+}
+
+int MetricsSampler::getNumSamples() const {
+    return samples_.size();
+}
+
+/**
+ * @brief      Takes the state as the sample of every interval boundary up to
+ *             the current time.
+ *
+ * @param[in]  state  (const Sample&) The state, its time is not used
+ * @param[in]  now    (long long) The current time in microseconds
+ */
+void MetricsSampler::record(const Sample& state, long long now) {
+    while (isDue(now)) {
+        samples_.push_back(state);
+        samples_.back().time = nextSample_;
+        nextSample_ += intervalMicros_;
+    }
+}
+
+/**
+ * @brief      Writes the samples in the configured format.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the samples.
+ */
+void MetricsSampler::write(std::ostream& out) const {
+    if (format_ == PROMETHEUS) {
+        writePrometheus(out);
+    }
+    else {
+        writeCSV(out);
+    }
+}
+
+/**
+ * @brief      Writes one row per sample, with a busy units column for every
+ *             device.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the samples.
+ */
+void MetricsSampler::writeCSV(std::ostream& out) const {
+    out << "\"Time {msec}\",\"Ready queue\",\"Waiting\",\"Memory in use {kbytes}\",\"Completed\"";
+    for (unsigned int i = 0; i < deviceNames_.size(); i++) {
+        out << ",\"" << deviceNames_[i] << " busy units\"";
+    }
+    out << std::endl;
+
+    out << std::fixed << std::setprecision(3);
+
+    for (unsigned int s = 0; s < samples_.size(); s++) {
+        const Sample& aSample = samples_[s];
+
+        out << (aSample.time / 1000.0) << "," << aSample.readyQueue << ","
+            << aSample.waiting << "," << aSample.memoryInUse << "," << aSample.completed;
+        for (unsigned int i = 0; i < aSample.busyUnits.size(); i++) {
+            out << "," << aSample.busyUnits[i];
+        }
+        out << std::endl;
+    }
+}
+
+/**
+ * @brief      Writes every metric family with its samples, time stamped in
+ *             milliseconds.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the samples.
+ */
+void MetricsSampler::writePrometheus(std::ostream& out) const {
+    writeFamily(out, "ossim_ready_queue_processes", "gauge", "Processes in the ready queue.", 0);
+    writeFamily(out, "ossim_waiting_processes", "gauge", "Processes waiting for memory or queued I/O.", 1);
+    writeFamily(out, "ossim_memory_in_use_kbytes", "gauge", "Memory allocated to processes.", 2);
+    writeFamily(out, "ossim_completed_processes_total", "counter", "Processes finished.", 3);
+    writeFamily(out, "ossim_device_busy_units", "gauge", "Device units serving a request.", 4);
+    out << "# EOF" << std::endl;
+}
+
+/**
+ * @brief      Writes one metric family.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the samples.
+ * @param[in]  name   (std::string) The metric name
+ * @param[in]  type   (std::string) gauge or counter
+ * @param[in]  help   (std::string) The description
+ * @param[in]  field  (int) The field of the samples: 0 ready queue, 1
+ *                    waiting, 2 memory, 3 completed, 4 busy units by device
+ */
+void MetricsSampler::writeFamily(std::ostream& out, std::string name, std::string type,
+                                 std::string help, int field) const {
+    out << "# HELP " << name << " " << help << std::endl;
+    out << "# TYPE " << name << " " << type << std::endl;
+
+    for (unsigned int s = 0; s < samples_.size(); s++) {
+        const Sample& aSample = samples_[s];
+        long long stamp = aSample.time / 1000;
+
+        switch (field) {
+            case 0:  out << name << " " << aSample.readyQueue << " " << stamp << std::endl;
+                     break;
+            case 1:  out << name << " " << aSample.waiting << " " << stamp << std::endl;
+                     break;
+            case 2:  out << name << " " << aSample.memoryInUse << " " << stamp << std::endl;
+                     break;
+            case 3:  out << name << " " << aSample.completed << " " << stamp << std::endl;
+                     break;
+            default: for (unsigned int i = 0; i < aSample.busyUnits.size(); i++) {
+                         out << name << "{device=\"" << deviceNames_[i] << "\"} "
+                             << aSample.busyUnits[i] << " " << stamp << std::endl;
+                     }
+                     break;
+        }
+    }
+}
+
+/**
+ * @brief      Writes the samples so far to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void MetricsSampler::save(CheckpointWriter& out) const {
+    out.putInt(nextSample_);
+
+    out.putInt(samples_.size());
+    for (unsigned int s = 0; s < samples_.size(); s++) {
+        const Sample& aSample = samples_[s];
+
+        out.putInt(aSample.time);
+        out.putInt(aSample.readyQueue);
+        out.putInt(aSample.waiting);
+        out.putInt(aSample.memoryInUse);
+        out.putInt(aSample.completed);
+
+        out.putInt(aSample.busyUnits.size());
+        for (unsigned int i = 0; i < aSample.busyUnits.size(); i++) {
+            out.putInt(aSample.busyUnits[i]);
+        }
+    }
+}
+
+/**
+ * @brief      Reads the samples so far from a checkpoint. The interval and
+ *             format are those of the configuration, so a restored run may
+ *             sample differently from here on.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void MetricsSampler::restore(CheckpointReader& in) {
+    nextSample_ = in.getInt();
+
+    samples_.resize(in.getInt());
+    for (unsigned int s = 0; s < samples_.size(); s++) {
+        Sample& aSample = samples_[s];
+
+        aSample.time = in.getInt();
+        aSample.readyQueue = in.getInt();
+        aSample.waiting = in.getInt();
+        aSample.memoryInUse = in.getInt();
+        aSample.completed = in.getInt();
+
+        aSample.busyUnits.resize(in.getInt());
+        if (aSample.busyUnits.size() > deviceNames_.size()) {
+            // throw exception
+            throw std::logic_error("MetricsSampler Class: Checkpoint Devices Do Not Match");
+        }
+        for (unsigned int i = 0; i < aSample.busyUnits.size(); i++) {
+            aSample.busyUnits[i] = in.getInt();
+        }
+    }
+}
+
+#endif
@@ -15,11 +15,26 @@
 #include <stdexcept>
 #include <vector>
 #include <deque>
+#include <algorithm>
+#include <map>
+#include <atomic>
+#include <random>
 #include <pthread.h>
-#include <semaphore.h>
 
 #include "MetaData.h"
-// ReadyQueue.h included with MetaData.h
+#include "ArrivalSource.h"
+#include "BuddyAllocator.h"
+#include "PagedMemory.h"
+#include "DiskScheduler.h"
+#include "IOBatcher.h"
+#include "CacheHierarchy.h"
+#include "MetricsSampler.h"
+#include "SimClock.h"
+#include "UnitFreeList.h"
+#include "InterruptController.h"
+#include "SimulationContext.h"
+// ReadyQueue.h included with ArrivalSource.h
+// RandomSource.h included with ArrivalSource.h
 // Configuration.h included with MetaData.h
 // CycleTime.h included with Configuration.h
 // Process.h included with ReadyQueue.h
@@ -40,145 +55,227 @@ public:
         std::string opDescription;
     };
 
+    // Struct for an end of run summary metric
+    struct SummaryInfo {
+        std::string metric; // name with unit, e.g. "Memory peak in use {kbytes}"
+        double value;
+    };
+
     // OVERLOADED CONSTRUCTOR
     OSprocessRunner(std::chrono::steady_clock::time_point begin,
-                    Configuration configObj) {
-        begin_ = begin;
+                    Configuration configObj)
+        : context_(configObj.getDevices()),
+          rng_((configObj.getReplaySeed() >= 0) ? configObj.getReplaySeed() : std::random_device()()) {
         configObj_ = configObj;
         systemMemorySize_ = configObj.getSystemMemory();
         memoryBlockSize_ = configObj.getBlockSize();
+        memoryMode_ = configObj.getMemoryMode();
+        diskPolicy_ = configObj.getDiskPolicy();
+        serviceJitter_ = configObj.getServiceJitter();
+        hardDriveDevice_ = configObj.getDevices().find("hard drive");
+        nextIORequest_ = 0;
         schedCode_ = configObj.getSchedCode();
         processCyclesExecuted_ = 0;
+        processesInRdyQ_ = 0;
+        numBlockedAllocations_ = 0;
+        numFailedAllocations_ = 0;
+        idleMicros_ = 0;
+        numIdlePeriods_ = 0;
+        contextSwitchMicros_ = configObj.getContextSwitchTime();
+        cacheRefillMicros_ = configObj.getCacheRefillTime();
+        cacheWarmMicros_ = configObj.getCacheWarmTime() * 1000LL;
+        lastProcess_ = -1;
+        numContextSwitches_ = 0;
+        switchMicros_ = 0;
+        refillMicros_ = 0;
+        cacheAccesses_ = configObj.getCacheAccesses();
+        cacheStallNanos_ = 0;
+        admissionLimit_ = configObj.getAdmissionLimit();
+        admissionPolicy_ = configObj.getAdmissionPolicy();
+        processesInSystem_ = 0;
+        maxProcessesInSystem_ = 0;
         quantumNumber_ = configObj_.getPQN();
         firstOperation_ = true;
-        // set interrupt flags for sched alg.'s to false
-        rrFlag_ = false;
-        strFlag_ = false;
         waitForOP_ = true;
+        restartQuantum_ = false;
+        stopTimer_ = false;
+        timerStarted_ = false;
+        sliceArmed_ = false;
+        sliceDeadline_ = 0;
+        checkpointTime_ = (configObj.getCheckpointTime() < 0) ? -1 : (configObj.getCheckpointTime() * 1000LL);
+        checkpointDone_ = false;
+
+        // Start the simulator's clock
+        clock_.start(begin, (configObj.getClockMode() == 1) ? SimClock::VIRTUAL_TIME
+                                                            : SimClock::REAL_TIME);
 
         // Set scheduling algorithm in ready queue
         readyQ_.setSchedAlgorithm(schedCode_);
+        readyQ_.setAging(configObj.getSTRAging());
     }
 
-    // STATIC DECLARATIONS FOR MUTEX AND SEMAPHORES
-    static pthread_mutex_t mutex1;
-    static pthread_mutex_t rdyQLock;
-    static pthread_mutex_t rrFlagLock;
-    static pthread_mutex_t waitForOP;
-    static pthread_mutex_t strFlagLock;
-
-    static sem_t hardDriveSemaphore;
-    static sem_t keyboardSemaphore;
-    static sem_t scannerSemaphore;
-    static sem_t monitorSemaphore;
-    static sem_t projectorSemaphore;
-
-    // STATIC DECLARATIONS FOR INTS TO HOLD NUMBER OF I/0 RESOURCES
-    static int hardDriveResources, 
-               keyboardResources, 
-               scannerResources, 
-               monitorResources, 
-               projectorResources;
-
-    // STATIC DECLARATIONS OF DEQUES TO HOLD SYSTEM RESOURCES
-    static std::deque<std::string> hardDriveDeque;
-    static std::deque<std::string> keyboardDeque;
-    static std::deque<std::string> scannerDeque;
-    static std::deque<std::string> monitorDeque;
-    static std::deque<std::string> projectorDeque;
+    // Destructor
+    ~OSprocessRunner() {
+        stopQuantumTimer();
+    }
 
     // GETTER FUNCTIONS
     double getTimeStamp(const int index);
     std::string getActor(const int index);
     std::string getOpDescription(const int index);
     int getNumOperations();
+    std::string getSummaryMetric(const int index);
+    double getSummaryValue(const int index);
+    int getNumSummaryItems();
+    const MetricsSampler& getMetrics() const;
 
     // PUBLIC FUNCTIONS
     void importMDF();
     void runProcesses();
-    static void fillResourceDeques(const int, const int, const int, const int, const int);
+    void enableLockStatistics();
+    void writeLockStatistics(std::ostream& out) const;
 
 private:
+    // Result of executing an operation
+    enum OpResult {OP_DONE, OP_BLOCKED_MEMORY, OP_WAITING_IO, OP_PREEMPTED};
+
+    // Traits of the scheduling algorithms, known at compile time so that
+    // each has its own dispatch loop
+    struct RoundRobin {
+        static const bool TIMED = true; // runs the quantum timer
+        static const bool SORTED = false; // keeps the ready queue sorted (by time remaining or deadline)
+        static const unsigned int PREEMPTING = InterruptController::TIMER;
+    };
+    struct ShortestTimeRemaining {
+        static const bool TIMED = false;
+        static const bool SORTED = true;
+        static const unsigned int PREEMPTING = InterruptController::ARRIVAL |
+                                               InterruptController::IO_COMPLETION;
+    };
+    struct EarliestDeadlineFirst {
+        static const bool TIMED = false;
+        static const bool SORTED = true;
+        static const unsigned int PREEMPTING = InterruptController::ARRIVAL |
+                                               InterruptController::IO_COMPLETION;
+    };
+
+    // Struct for a process waiting on a queued I/O request
+    struct IOWait {
+        Process process;
+        char code; // 'I' or 'O'
+        int deviceIndex;
+    };
+
     // PRIVATE DATA
     ReadyQueue readyQ_; // ready queue of processes
     Configuration configObj_;
-    bool timerComplete_; // flag for polling
-    bool ioComplete_; // flag for polling
-    bool rrFlag_; // flag for round robin interrupt after 50 ms; set in seperate thread
-    bool waitForOP_; // used in quantum countdown thread.
+    SimulationContext context_; // locks and device units of this simulation
+    RandomSource rng_; // every random choice, seeded by the replay seed if there is one
+    int serviceJitter_; // percent that service times vary by
+    std::atomic<bool> timerComplete_; // flag for polling
+    std::atomic<bool> ioComplete_; // flag for polling
+    InterruptController interrupts_; // pending interrupts, raised by the timer, arrivals and I/O
+    std::atomic<bool> waitForOP_; // used in quantum countdown thread.
+    std::atomic<bool> restartQuantum_; // drops the quantum being counted down
     bool firstOperation_; // starts the quantum countdown thread on first operation.
-    bool strFlag_; // flag for shortest time remaining; set after new processes added to ready queue
-    int countDownTime_;
-    int ioTime_;
+    std::atomic<bool> stopTimer_; // ends the quantum countdown thread
+    bool timerStarted_; // the quantum countdown thread is running
+    pthread_t timerTid_; // the quantum countdown thread
+    long long countDownMicros_;
+    long long ioMicros_;
     std::vector<OperationInfo> operationsVect_; // info structs for log output
-    std::chrono::steady_clock::time_point begin_; // start time
+    SimClock clock_; // simulator's clock, real or virtual time
+    ArrivalSource arrivals_; // schedule of process arrivals
+    bool sliceArmed_; // virtual time: quantum is counting down
+    long long sliceDeadline_; // virtual time: end of the quantum in microseconds
+    long long checkpointTime_; // microseconds, -1 for no checkpoint
+    bool checkpointDone_; // the checkpoint was written, or this run was restored from one
     int systemMemorySize_;
     int memoryBlockSize_;
-    long memAddress_;
-    int schedCode_; // 0 for Round Robin, 1 for Shortest Time Remaining
+    BuddyAllocator memory_; // system memory allocator
+    int memoryMode_; // 0 for buddy, 1 for paged
+    PagedMemory pagedMemory_; // virtual memory, one frame per memory block
+    int hardDriveDevice_; // registry index of the hard drive, -1 if none
+    int diskPolicy_; // -1 for off, else the DiskScheduler::Policy
+    DiskScheduler disk_; // hard drive request queues
+    IOBatcher batcher_; // batching stage of the devices with a batch window
+    std::map<int, IOWait> ioWaitQ_; // processes waiting on queued I/O by request id
+    int nextIORequest_; // id of the next queued I/O request
+    std::deque<Process> memoryWaitQ_; // processes blocked on M{allocate}
+    long numBlockedAllocations_;
+    long numFailedAllocations_;
+    long long idleMicros_; // time with no process on the CPU
+    long numIdlePeriods_;
+    long long contextSwitchMicros_; // cost of every switch between processes
+    long long cacheRefillMicros_; // cost of refilling a cold cache
+    long long cacheWarmMicros_; // CPU time of other processes that cools a cache, 0 for always cold
+    int lastProcess_; // process number last on the CPU, -1 for none
+    long numContextSwitches_;
+    long long switchMicros_; // total time spent switching
+    long long refillMicros_; // total time spent refilling caches
+    CacheHierarchy cache_; // CPU caches, accessed by processing actions with a working set
+    int cacheAccesses_; // working set accesses per processing cycle
+    long long cacheStallNanos_; // total time processing actions waited on the caches
+    std::vector<long long> latenessMicros_; // finish time minus deadline of every process with one
+    std::vector<long long> readyWaitMicros_; // longest ready queue wait of every finished process
+    int admissionLimit_; // processes admitted and not finished, 0 for no limit
+    int admissionPolicy_; // 0 for queue, 1 for reject, 2 for throttle
+    int processesInSystem_; // processes admitted and not finished
+    int maxProcessesInSystem_;
+    std::vector<SummaryInfo> summaryVect_; // end of run metrics
+    MetricsSampler metrics_; // time series of the queues and devices
+    int schedCode_; // 0 for Round Robin, 1 for Shortest Time Remaining, 2 for Earliest Deadline First
     int processesInRdyQ_; // # processes in ready queue (avoids having to lock in while loop test)
     int processCyclesExecuted_; // number of cycles current process has executed since last interrupt
     int quantumNumber_; // Round Robin quantum time slice in milliseconds
 
     // PRIVATE FUNCTIONS
-    void executeOperation(const MetaCommand metaCmdObj, int processIndex);
+    template <class Policy> void dispatch();
+    template <class Policy> OpResult executeOperation(const MetaCommand& metaCmdObj, Process& aProcess);
+    template <class Policy> int runCycles(const MetaCommand& anOp, int cyclesDone, int processIndex);
+    void accessWorkingSet(const MetaCommand& anOp, int cycle, int processIndex);
     void countDownThreadFunction();
     static void* countDownThreadHelper(void *obj);
     void countDown(int time);
+    long long serviceTime(int time);
     void quantumTimerThreadFunction();
     static void* quantumTimerHelper(void *obj);
     void quantumTimer();
-    void loadMDFThreadFunction();
-    static void* loadMDFHelper(void *obj);
-    void loadMDF();
+    void stopQuantumTimer();
+    void checkVirtualQuantum();
+    int admitArrivals();
+    void sampleMetrics();
+    bool hasAdmissibleArrival() const;
     void ioThreadFunction();
     static void* ioThreadHelper(void *obj);
-    void inputOutput(int time, std::string aDescriptor, std::string& resource);
+    int inputOutput(int time, int deviceIndex);
+    std::string unitName(int deviceIndex, int unit);
     void logInterruption(int processIndex);
+    void logEvent(std::string actor, std::string description);
+    long long busyMicros() const;
+    void switchContext(Process& aProcess);
+    void leaveCPU(Process& aProcess);
+    void blockForMemory(Process& aProcess);
+    void wakeMemoryWaiters(int count);
+    void referencePages(int numReferences, int processIndex);
+    void blockForIO(Process& aProcess, const MetaCommand& anOp);
+    int completeIORequests();
+    void readyAfterIO(int id, std::string description);
+    bool hasPendingIO() const;
+    void saveCheckpoint();
+    void restoreCheckpoint(std::string filePath);
+    void buildSummary();
 };
 
 //******************************************************************************
 // IMPLEMENTATION
 //******************************************************************************
 
-/* Unlike regular class attributes, static class attributes are only declared in the
- * class header, they are not defined. They need to be defined in the implementation
- * file or section in order to avoid linker errors. Below are the definitions of the
- * static attributes.
- */
-
-// STATIC DEFINITIONS FOR MUTEX AND SEMAPHORES
-pthread_mutex_t OSprocessRunner::mutex1;
-pthread_mutex_t OSprocessRunner::rdyQLock;
-pthread_mutex_t OSprocessRunner::rrFlagLock;
-pthread_mutex_t OSprocessRunner::waitForOP;
-pthread_mutex_t OSprocessRunner::strFlagLock;
-
-sem_t OSprocessRunner::hardDriveSemaphore;
-sem_t OSprocessRunner::keyboardSemaphore;
-sem_t OSprocessRunner::scannerSemaphore;
-sem_t OSprocessRunner::monitorSemaphore;
-sem_t OSprocessRunner::projectorSemaphore;
-
-// STATIC DEFINITIONS FOR INTS TO HOLD NUMBER OF I/0 RESOURCES
-int OSprocessRunner::hardDriveResources, 
-           OSprocessRunner::keyboardResources, 
-           OSprocessRunner::scannerResources, 
-           OSprocessRunner::monitorResources, 
-           OSprocessRunner::projectorResources;
-
-// STATIC DEFINITIONS OF DEQUES TO HOLD RESOURCES
-std::deque<std::string> OSprocessRunner::hardDriveDeque;
-std::deque<std::string> OSprocessRunner::keyboardDeque;
-std::deque<std::string> OSprocessRunner::scannerDeque;
-std::deque<std::string> OSprocessRunner::monitorDeque;
-std::deque<std::string> OSprocessRunner::projectorDeque;
-
-
 /**
  * @brief      Imports the MDF
  * 
- * This function is called by the thread function loadMDFThreadFunction()
+ * The meta data file is parsed once. The parsed processes become the
+ * workload of the arrival schedule chosen in the configuration file.
  * 
  */
 void OSprocessRunner::importMDF() {
@@ -190,44 +287,177 @@ void OSprocessRunner::importMDF() {
     metaDataObj.setConfigurationObject(configObj_);
 
     // Parse the meta data file with the MetaData object
-    metaDataObj.parseMDF(configObj_.getMdfFilePath(), readyQ_);
-
-    // get the size of ready queue while locked
-    processesInRdyQ_ = readyQ_.getNumberOfProcesses();
+    std::vector<Process> workload;
+    metaDataObj.parseMDF(configObj_.getMdfFilePath(), workload);
+
+    // Build the arrival schedule
+    arrivals_.setWorkload(workload);
+
+    switch (configObj_.getArrivalMode()) {
+        case 0:  arrivals_.buildReload(configObj_.getReloadCount(),
+                                       configObj_.getReloadInterval());
+                 break;
+        case 1:  arrivals_.buildSchedule(configObj_.getArrivalFilePath());
+                 break;
+        case 2:  arrivals_.buildPoisson(configObj_.getArrivalRate(),
+                                        configObj_.getArrivalCount(),
+                                        configObj_.getArrivalSeed());
+                 break;
+    }
 }
 
 /**
  * @brief      Public function that runs multiple processes in an application
  * 
  * This function determines which of the two scheduling algorithms are being used.
- * Round robin or shortest time remaining.
+ * Round robin or shortest time remaining. Processes arrive on the simulator's
+ * clock; when the ready queue is empty the runner waits for the next arrival.
  *
  */
 void OSprocessRunner::runProcesses() {
 
-    // Initialize the memory allocation address to zero
-    memAddress_ = 0;
+    // A checkpoint holds virtual time only
+    if (((checkpointTime_ >= 0) || (!configObj_.getRestoreFilePath().empty())) && (!clock_.isVirtual())) {
+        // throw exception
+        throw std::logic_error("OSprocessRunner Class: Checkpoints Need Virtual Time");
+    }
 
-    // Get ready queue mutex lock
-    pthread_mutex_lock(&rdyQLock);
+    // Initialize the system memory
+    if ((memoryMode_ == 1) || (diskPolicy_ >= 0)) {
+        if ((hardDriveDevice_ < 0) || (configObj_.getDevices().get(hardDriveDevice_).cycleTime < 0)) {
+            // throw exception
+            throw std::logic_error("OSprocessRunner Class: Paging And Disk Scheduling Need A Hard Drive");
+        }
+    }
 
-    // Import meta data file initially
-    importMDF(); // this uses the ready queue/needs to be locked
+    if (memoryMode_ == 1) {
+        pagedMemory_.initialize(systemMemorySize_ / memoryBlockSize_, memoryBlockSize_,
+                                (PagedMemory::Policy)configObj_.getPagePolicy(),
+                                configObj_.getTLBEntries());
+    }
+    else {
+        memory_.initialize(systemMemorySize_, 1);
+    }
 
-    // if STR sort ready queue
-    if (schedCode_ == 1)
-        readyQ_.sortReadyQueue();
+    // Initialize the hard drive request queues
+    if (diskPolicy_ >= 0) {
+        disk_.initialize(configObj_.getDevices().get(hardDriveDevice_).quantity,
+                         configObj_.getDiskTracks(), (DiskScheduler::Policy)diskPolicy_,
+                         configObj_.getSeekSettle(), configObj_.getSeekPerTrack());
+    }
 
-    // Release ready queue mutex lock
-    pthread_mutex_unlock(&rdyQLock);
+    // Initialize the batching stage of the devices with a batch window
+    batcher_.initialize(configObj_.getDevices());
+
+    // Initialize the CPU caches
+    if (!configObj_.getCacheLevels().empty()) {
+        cache_.initialize(configObj_.getCacheLevels(), configObj_.getCacheLineSize(),
+                          configObj_.getMemoryAccessTime());
+    }
+
+    // Initialize the time series of the queues and devices
+    metrics_.initialize(configObj_.getMetricsInterval() * 1000LL,
+                        (MetricsSampler::Format)configObj_.getMetricsFormat(),
+                        configObj_.getDevices());
+
+    if (!configObj_.getRestoreFilePath().empty()) {
+        // Continue from the state in the checkpoint
+        restoreCheckpoint(configObj_.getRestoreFilePath());
+    }
+    else {
+        // Import meta data file and build the arrival schedule
+        importMDF();
+
+        // Record the seed, so that the run can be replayed from its log
+        if (configObj_.getReplaySeed() >= 0) {
+            logEvent("OS", "replay seed " + std::to_string(configObj_.getReplaySeed()));
+        }
+
+        // Deliver the processes that arrive at time zero
+        admitArrivals();
+    }
+
+    // Run the dispatch loop of the scheduling algorithm
+    if (schedCode_ == 0) {
+        dispatch<RoundRobin>();
+    }
+    else if (schedCode_ == 1) {
+        dispatch<ShortestTimeRemaining>();
+    }
+    else {
+        dispatch<EarliestDeadlineFirst>();
+    }
+
+    // The timer thread uses this object, so it must end with the run
+    stopQuantumTimer();
+
+    buildSummary();
+}
+
+/**
+ * @brief      Dispatches processes from the ready queue until every process
+ *             has finished.
+ * 
+ * The loop is instantiated once for each scheduling algorithm, so the checks
+ * on the algorithm's traits are resolved at compile time.
+ *
+ * @tparam     Policy  RoundRobin, ShortestTimeRemaining or EarliestDeadlineFirst
+ */
+template <class Policy>
+void OSprocessRunner::dispatch() {
+    // the CPU idled since the last process left it
+    bool wasIdle = false;
+
+    while ((processesInRdyQ_ > 0) || arrivals_.hasPending() || (!memoryWaitQ_.empty()) ||
+           hasPendingIO()) {
+
+        // Between processes every process is in a queue, so the whole
+        // state can be written
+        if ((checkpointTime_ >= 0) && (!checkpointDone_) && (clock_.nowMicros() >= checkpointTime_)) {
+            saveCheckpoint();
+        }
+
+        if (processesInRdyQ_ == 0) {
+            if (hasAdmissibleArrival() || hasPendingIO()) {
+                // Nothing is ready, the CPU idles until the next arrival or
+                // I/O event. Every event time is known, so the wait blocks
+                // until then instead of polling.
+                long long nextEvent = hasAdmissibleArrival() ? arrivals_.nextArrivalTime() : -1;
+
+                if (disk_.hasPending() && ((nextEvent < 0) || (disk_.nextCompletionTime() < nextEvent))) {
+                    nextEvent = disk_.nextCompletionTime();
+                }
+                if (batcher_.hasPending() && ((nextEvent < 0) || (batcher_.nextEventTime() < nextEvent))) {
+                    nextEvent = batcher_.nextEventTime();
+                }
+
+                long long idleStart = clock_.nowMicros();
+
+                // No quantum runs while the CPU idles
+                sliceArmed_ = false;
+                restartQuantum_ = true;
+                wasIdle = true;
+
+                clock_.waitUntil(nextEvent);
+                sampleMetrics();
 
-    // Set up load thread to load the metadata file into ready queue every 100 ms    
-    loadMDF();
+                idleMicros_ += clock_.nowMicros() - idleStart;
+                numIdlePeriods_++;
 
-    while (processesInRdyQ_ > 0) {
+                admitArrivals();
+                completeIORequests();
+            }
+            else {
+                // Only processes blocked on memory are left, and any
+                // arrivals wait for them to finish. Let the oldest
+                // retry alone, so it fails its allocation instead of blocking.
+                wakeMemoryWaiters(1);
+            }
+            continue;
+        }
 
         // Get the ready queue mutex lock
-        pthread_mutex_lock(&rdyQLock);
+        context_.lockReadyQueue();
         
         // remove process from front of ready queue
         Process currentProcess = readyQ_.removeProcess();
@@ -236,124 +466,122 @@ void OSprocessRunner::runProcesses() {
         processesInRdyQ_ = readyQ_.getNumberOfProcesses();
 
         // Release ready queue mutex lock
-        pthread_mutex_unlock(&rdyQLock);
+        context_.unlockReadyQueue();
+
+        currentProcess.recordReadyWait(clock_.nowMicros() - currentProcess.getReadySince());
+
+        // A different process takes the CPU
+        if (currentProcess.getProcessNumber() != lastProcess_) {
+            switchContext(currentProcess);
+        }
+
+        // The ready queue was ordered with every arrival and I/O completion
+        // so far, so they are no reason to interrupt this process
+        interrupts_.acknowledge(InterruptController::ARRIVAL | InterruptController::IO_COMPLETION);
+
+        // A quantum that ended while the CPU idled belongs to no process
+        if (wasIdle) {
+            interrupts_.acknowledge(InterruptController::TIMER);
+            wasIdle = false;
+        }
 
         // loop while there are operations left in the process
         while (currentProcess.getOpIndex() < currentProcess.getNumberOfCommands()) {
-            // Check for interrupt conditions
-            if (schedCode_ == 0) { // Round Robin
+            // Deliver any processes that have arrived or finished their queued
+            // I/O requests, raising their interrupts
+            admitArrivals();
+            completeIORequests();
 
+            if (Policy::TIMED) {
                 // Start quantum timer if first operation
                 if (firstOperation_) {
                     firstOperation_ = false;
                     quantumTimer();
                 }
 
-                // Get the rrFlagLock mutex lock
-                pthread_mutex_lock(&rrFlagLock);
-
-                // check RR timer interrupt flag
-                if (rrFlag_ == true) {
-
-                    // reset the flag to false
-                    rrFlag_ = false;
-
-                    // Get the ready queue mutex lock
-                    pthread_mutex_lock(&rdyQLock);
-
-                    // push process onto back of ready queue
-                    readyQ_.insertProcess(currentProcess);
-
-                    // Release ready queue mutex lock
-                    pthread_mutex_unlock(&rdyQLock);
-
-                    logInterruption(currentProcess.getProcessNumber());
-
-                    // Release rrFlagLock mutex lock
-                    pthread_mutex_unlock(&rrFlagLock);
-
-                    // break out of while loop
-                    break;
+                // In virtual time the quantum is measured on the clock
+                if (clock_.isVirtual()) {
+                    checkVirtualQuantum();
                 }
+            }
 
-                // Release rrFlagLock mutex lock (outside of if statement)
-                pthread_mutex_unlock(&rrFlagLock);
-
-                // get waitForOP mutex lock
-                pthread_mutex_lock(&waitForOP);
-
-                // set flag
-                waitForOP_ = false;
-
-                // release waitForOP mutex lock
-                pthread_mutex_unlock(&waitForOP);
-
-                // execute operation
-                executeOperation(currentProcess.getMetaCommand(currentProcess.getOpIndex()),
-                                 currentProcess.getProcessNumber());
-
-                // increment the current operation index of the process
-                currentProcess.incrementOpIndex();
-            } 
+            // Take every pending interrupt. Round robin is interrupted by the
+            // timer, shortest time remaining by processes becoming ready.
+            if (interrupts_.acknowledge(InterruptController::ALL) & Policy::PREEMPTING) {
+                leaveCPU(currentProcess);
 
-            else if (schedCode_ == 1) { // Shortest Time Remaining
-                // Get the strFlagLock mutex lock
-                pthread_mutex_lock(&strFlagLock);
+                // Get the ready queue mutex lock
+                context_.lockReadyQueue();
 
-                // check STR timer interrupt flag
-                if (strFlag_ == true) {
+                // push process onto back of ready queue
+                readyQ_.insertProcess(currentProcess, clock_.nowMicros());
 
-                    // reset the flag to false
-                    strFlag_ = false;
+                // if STR or EDF sort the ready queue
+                if (Policy::SORTED) {
+                    readyQ_.sortReadyQueue();
+                }
 
-                    // Get the ready queue mutex lock
-                    pthread_mutex_lock(&rdyQLock);
+                // Release ready queue mutex lock
+                context_.unlockReadyQueue();
 
-                    // push process onto back of ready queue
-                    readyQ_.insertProcess(currentProcess);
+                logInterruption(currentProcess.getProcessNumber());
 
-                    // sort the ready quque
-                    readyQ_.sortReadyQueue();
+                // break out of while loop
+                break;
+            }
 
-                    // Release ready queue mutex lock
-                    pthread_mutex_unlock(&rdyQLock);
+            // start the quantum countdown with this operation
+            if (Policy::TIMED) {
+                waitForOP_ = false;
+            }
 
-                    logInterruption(currentProcess.getProcessNumber());
+            // execute operation, leave the CPU if it blocked
+            const MetaCommand& currentOp = currentProcess.getCurrentCommand();
+            int cyclesBefore = currentProcess.getCyclesDone();
+            OpResult result = executeOperation<Policy>(currentOp, currentProcess);
 
-                    // Release strFlagLock mutex lock
-                    pthread_mutex_unlock(&strFlagLock);
+            if (result == OP_BLOCKED_MEMORY) {
+                leaveCPU(currentProcess);
+                blockForMemory(currentProcess);
+                break;
+            }
 
-                    // break out of while loop
-                    break;
+            // A preempted operation keeps its place; the pending interrupt
+            // takes the process off the CPU on the next iteration
+            if (result == OP_PREEMPTED) {
+                if (Policy::SORTED) {
+                    currentProcess.subtractProcessTimeRemain(
+                        currentOp.getTimeOfCycles(currentProcess.getCyclesDone() - cyclesBefore));
                 }
+                continue;
+            }
 
-                // Release strFlagLock mutex lock (outside of if statement)
-                pthread_mutex_unlock(&strFlagLock);
-
-                // execute operation
-                executeOperation(currentProcess.getMetaCommand(currentProcess.getOpIndex()),
-                                 currentProcess.getProcessNumber());
+            // update time remaining in process by subtracting time for executed operation
+            if (Policy::SORTED) {
+                currentProcess.subtractProcessTimeRemain(currentOp.getTime() -
+                                                         currentOp.getTimeOfCycles(cyclesBefore));
+            }
 
-                // update time remaining in process by subtracting time for executed operation
-                MetaCommand tempMetaCmdObj;
-                tempMetaCmdObj = currentProcess.getMetaCommand(currentProcess.getOpIndex());
-                int timeForOP = tempMetaCmdObj.getTime();
-                currentProcess.subtractProcessTimeRemain(timeForOP);
+            // increment the current operation index of the process
+            currentProcess.incrementOpIndex();
 
-                // increment the current operation index of the process
-                currentProcess.incrementOpIndex();
+            // wait off the CPU for a queued I/O request
+            if (result == OP_WAITING_IO) {
+                leaveCPU(currentProcess);
+                blockForIO(currentProcess, currentOp);
+                break;
             }
         }
 
         // Get ready queue mutex lock
-        pthread_mutex_lock(&rdyQLock);
+        context_.lockReadyQueue();
 
         // get updated number of processes in ready queue
         processesInRdyQ_ = readyQ_.getNumberOfProcesses();
 
         // Release ready queue mutex lock
-        pthread_mutex_unlock(&rdyQLock);
-    }    
+        context_.unlockReadyQueue();
+    }
 }
 
 /**
@@ -365,10 +593,25 @@ void OSprocessRunner::runProcesses() {
  * to handle I/O and time based operations.
  *
  * @param[in]  (MetaCommand) metaCmdObj  The meta command object
- * @param[in]  (int) processIndex        The number of the process
+ * @param      (Process&) aProcess       The process running the operation
+ *
+ * @return     (OpResult) OP_BLOCKED_MEMORY if the process blocked before the
+ *                        operation could run, OP_WAITING_IO if the
+ *                        operation was queued on a hard drive or in a
+ *                        batch, OP_PREEMPTED if an interrupt stopped a
+ *                        processing action between cycles, OP_DONE
+ *                        otherwise.
+ *
+ * @tparam     Policy  The scheduling algorithm, which decides when a
+ *                     processing action is preempted
  */
+template <class Policy>
+OSprocessRunner::OpResult OSprocessRunner::executeOperation(const MetaCommand& metaCmdObj, Process& aProcess) {
+    ScopedPhaseTimer timer("Execute operation");
+
+    // get the process number
+    int processIndex = aProcess.getProcessNumber();
 
-void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int processIndex) {
     // get code
     char aCode = metaCmdObj.getCode();
 
@@ -387,10 +630,7 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
                 OperationInfo opAbeginInfo1;
 
                 // timestamp preparing
-                auto opAbeginTime1 = std::chrono::steady_clock::now();
-                std::chrono::duration<double> aDuration1;
-                aDuration1 = (opAbeginTime1 - begin_);
-                opAbeginInfo1.timeStamp = aDuration1.count();
+                opAbeginInfo1.timeStamp = clock_.nowSeconds();
 
                 // Assign actor
                 opAbeginInfo1.actor = "OS";
@@ -405,10 +645,7 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
                 OperationInfo opAbeginInfo2;
 
                 // timestamp start
-                auto opAbeginTime2 = std::chrono::steady_clock::now();
-                std::chrono::duration<double> aDuration2;
-                aDuration2 = (opAbeginTime2 - begin_);
-                opAbeginInfo2.timeStamp = aDuration2.count();
+                opAbeginInfo2.timeStamp = clock_.nowSeconds();
 
                 // Assign actor
                 opAbeginInfo2.actor = "OS";
@@ -426,10 +663,7 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
                 OperationInfo opAendInfo;
 
                 // timestamp end
-                auto opAendTime = std::chrono::steady_clock::now();
-                std::chrono::duration<double> aDuration;
-                aDuration = (opAendTime - begin_);
-                opAendInfo.timeStamp = aDuration.count();
+                opAendInfo.timeStamp = clock_.nowSeconds();
 
                 // Assign actor
                 opAendInfo.actor = "OS";
@@ -439,6 +673,37 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
 
                 // Push operation information onto vector
                 operationsVect_.push_back(opAendInfo);
+
+                readyWaitMicros_.push_back(aProcess.getMaxReadyWait());
+
+                // Account for the deadline, if the process has one
+                if (aProcess.getDeadline() >= 0) {
+                    long long lateness = clock_.nowMicros() - aProcess.getDeadline();
+
+                    latenessMicros_.push_back(lateness);
+
+                    if (lateness > 0) {
+                        std::stringstream stream;
+                        stream << std::fixed << std::setprecision(3) << (lateness / 1000.0);
+
+                        logEvent("OS", "process " + std::to_string(processIndex) +
+                                       " missed its deadline by " + stream.str() + " ms");
+                    }
+                }
+
+                // Release the process's memory and wake one waiter per block
+                if (memoryMode_ == 1) {
+                    pagedMemory_.releaseProcess(processIndex);
+                }
+                else {
+                    wakeMemoryWaiters(memory_.freeOwner(processIndex));
+                }
+
+                // The process leaves the system, a held arrival takes its place
+                processesInSystem_--;
+                if (admissionLimit_ > 0) {
+                    admitArrivals();
+                }
             }
             break;
         }
@@ -449,16 +714,16 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
             OperationInfo opPMstartInfo;
 
             // timestamp start
-            auto opPMstartTime = std::chrono::steady_clock::now();
-            std::chrono::duration<double> startDuration;
-            startDuration = (opPMstartTime - begin_);
-            opPMstartInfo.timeStamp = startDuration.count();
+            opPMstartInfo.timeStamp = clock_.nowSeconds();
 
             // Assign actor
             opPMstartInfo.actor = "Process " + std::to_string(processIndex);
 
             // assign description
-            if (aDescriptor == "run") {
+            if ((aDescriptor == "run") && (aProcess.getCyclesDone() > 0)) {
+                opPMstartInfo.opDescription = "resume processing action";
+            }
+            else if (aDescriptor == "run") {
                 opPMstartInfo.opDescription = "start processing action";
             }
             else if (aDescriptor == "block") {
@@ -471,18 +736,54 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
             // Push operation onto vector
             operationsVect_.push_back(opPMstartInfo);
 
-            // Open a coundown timer thread and wait for it to
-            // finish counting down
-            countDown(metaCmdObj.getTime());
+            // Take the memory block before the operation runs
+            long memAddress = -1;
+            if ((aDescriptor == "allocate") && (memoryMode_ == 1)) {
+                // Paged memory never blocks, the page is loaded on first use
+                memAddress = pagedMemory_.allocatePage(processIndex);
+            }
+            else if (aDescriptor == "allocate") {
+                if (memory_.canEverFit(memoryBlockSize_)) {
+                    memAddress = memory_.allocate(memoryBlockSize_, processIndex);
+                }
+
+                // Block until memory is freed, unless no other process could
+                // free it or the block is larger than the system memory
+                if ((memAddress < 0) && memory_.canEverFit(memoryBlockSize_) &&
+                    ((processesInRdyQ_ > 0) || hasAdmissibleArrival() || hasPendingIO())) {
+                    logEvent("Process " + std::to_string(processIndex),
+                             "memory allocation blocked, waiting for free memory");
+                    numBlockedAllocations_++;
+                    return OP_BLOCKED_MEMORY;
+                }
+            }
+
+            // In paged memory every memory blocking cycle references a page
+            if ((aDescriptor == "block") && (memoryMode_ == 1)) {
+                referencePages(metaCmdObj.getCycles(), processIndex);
+            }
+
+            // A processing action runs cycle by cycle and stops early if
+            // an interrupt would preempt the process
+            if (aDescriptor == "run") {
+                aProcess.addCyclesDone(runCycles<Policy>(metaCmdObj, aProcess.getCyclesDone(),
+                                                          processIndex));
+
+                if (aProcess.getCyclesDone() < metaCmdObj.getCycles()) {
+                    return OP_PREEMPTED;
+                }
+            }
+            else {
+                // Open a coundown timer thread and wait for it to
+                // finish counting down
+                countDown(metaCmdObj.getTime());
+            }
 
             // Create OperationInfo struct for end
             OperationInfo opPMendInfo;
 
             // timestamp end
-            auto opPMendTime = std::chrono::steady_clock::now();
-            std::chrono::duration<double> endDuration;
-            endDuration = (opPMendTime - begin_);
-            opPMendInfo.timeStamp = endDuration.count();
+            opPMendInfo.timeStamp = clock_.nowSeconds();
 
             // Assign actor
             opPMendInfo.actor = "Process " + std::to_string(processIndex);
@@ -495,24 +796,19 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
                 // Assign description
                 opPMendInfo.opDescription = "end memory blocking";
             }
+            else if ((aDescriptor == "allocate") && (memAddress < 0)) {
+                // Assign description
+                opPMendInfo.opDescription = "memory allocation failed";
+                numFailedAllocations_++;
+            }
             else if (aDescriptor == "allocate") {
                 // assign the starting memory address for the block
                 std::stringstream stream;
-                stream << "0x" << std::hex << std::setw(8) << std::setfill('0') << memAddress_;
+                stream << "0x" << std::hex << std::setw(8) << std::setfill('0') << memAddress;
                 std::string hexAddress = stream.str();
 
                 // Assign description
                 opPMendInfo.opDescription = "memory allocated at " + hexAddress;
-
-                // check to see if the next block will overflow the bounds
-                // of the system memory. If so, reset to zero
-                if ((memAddress_ + memoryBlockSize_) > systemMemorySize_) {
-                    memAddress_ = 0;
-                }
-                else {
-                    // Set the address for the next memory allocation
-                    memAddress_ += memoryBlockSize_;
-                }
             }
 
             // Push operation information onto vector
@@ -523,76 +819,67 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
         case 'I':
         case 'O':
         {
+            // With disk scheduling a hard drive request is queued, and the
+            // process waits for it off the CPU
+            if ((diskPolicy_ >= 0) && (metaCmdObj.getDeviceIndex() == hardDriveDevice_)) {
+                int drive = disk_.submit(nextIORequest_, metaCmdObj.getTrack(),
+                                         serviceTime(metaCmdObj.getTime()), clock_.nowMicros());
+                std::string direction = (aCode == 'I') ? " input" : " output";
+                std::string description = "start hard drive" + direction + " on " +
+                                          unitName(hardDriveDevice_, drive);
+
+                if (metaCmdObj.getTrack() >= 0) {
+                    description += ", track " + std::to_string(metaCmdObj.getTrack());
+                }
+
+                logEvent("Process " + std::to_string(processIndex), description);
+
+                return OP_WAITING_IO;
+            }
+
+            // A batching device queues the request in its open batch
+            if (batcher_.isBatched(metaCmdObj.getDeviceIndex())) {
+                std::string direction = (aCode == 'I') ? " input" : " output";
+
+                batcher_.submit(nextIORequest_, metaCmdObj.getDeviceIndex(), (aCode == 'I'),
+                                serviceTime(metaCmdObj.getTime()), clock_.nowMicros());
+
+                logEvent("Process " + std::to_string(processIndex),
+                         "queue " + aDescriptor + direction + " for batching");
+
+                return OP_WAITING_IO;
+            }
+
             // Create start struct
             OperationInfo opIOstartInfo;
 
             // Create end struct
             OperationInfo opIOendInfo;
 
-            // Create string for resource
-            std::string resource;
 
             // timestamp start
-            auto opIOstartTime = std::chrono::steady_clock::now();
-            std::chrono::duration<double> startDuration;
-            startDuration = (opIOstartTime - begin_);
-            opIOstartInfo.timeStamp = startDuration.count();
+            opIOstartInfo.timeStamp = clock_.nowSeconds();
 
             // Open a IO thread and wait for it to finish
-            inputOutput(metaCmdObj.getTime(), aDescriptor, resource);
+            int unit = inputOutput(metaCmdObj.getTime(), metaCmdObj.getDeviceIndex());
 
             // timestamp end
-            auto opIOendTime = std::chrono::steady_clock::now();
-            std::chrono::duration<double> endDuration;
-            endDuration = (opIOendTime - begin_);
-            opIOendInfo.timeStamp = endDuration.count();
+            opIOendInfo.timeStamp = clock_.nowSeconds();
+
+            // The descriptor is the device name, e.g. "start hard drive input on HDD_0"
+            std::string direction = (aCode == 'I') ? " input" : " output";
 
             // Assign actor and description for operation start
             opIOstartInfo.actor = "Process " + std::to_string(processIndex);
-
-            if ((aDescriptor == "hard drive") && (aCode == 'I')) {
-                opIOstartInfo.opDescription = "start hard drive input on " + resource;
-            }
-            else if ((aDescriptor == "hard drive") && (aCode == 'O')) {
-                opIOstartInfo.opDescription = "start hard drive output on " + resource;
-            }
-            else if (aDescriptor == "keyboard") {
-                opIOstartInfo.opDescription = "start keyboard input on " + resource;
-            }
-            else if (aDescriptor == "scanner") {
-                opIOstartInfo.opDescription = "start scanner input on " + resource;
-            }
-            else if (aDescriptor == "monitor") {
-                opIOstartInfo.opDescription = "start monitor output on " + resource;
-            }
-            else if (aDescriptor == "projector") {
-                opIOstartInfo.opDescription = "start projector output on " + resource;
-            }
+            opIOstartInfo.opDescription = "start " + aDescriptor + direction + " on " +
+                                          unitName(metaCmdObj.getDeviceIndex(), unit);
 
             // Push operation start information onto vector
             operationsVect_.push_back(opIOstartInfo);
 
             // Assign actor and description for operation end
             opIOendInfo.actor = "Process " + std::to_string(processIndex);
-
-            if ((aDescriptor == "hard drive") && (aCode == 'I')) {
-                opIOendInfo.opDescription = "end hard drive input";
-            }
-            else if ((aDescriptor == "hard drive") && (aCode == 'O')) {
-                opIOendInfo.opDescription = "end hard drive output";
-            }
-            else if (aDescriptor == "keyboard") {
-                opIOendInfo.opDescription = "end keyboard input";
-            }
-            else if (aDescriptor == "scanner") {
-                opIOendInfo.opDescription = "end scanner input";
-            }
-            else if (aDescriptor == "monitor") {
-                opIOendInfo.opDescription = "end monitor output";
-            }
-            else if (aDescriptor == "projector") {
-                opIOendInfo.opDescription = "end projector output";
-            }
+            opIOendInfo.opDescription = "end " + aDescriptor + direction;
 
             // Push operation end intormation onto vector
             operationsVect_.push_back(opIOendInfo);
@@ -600,8 +887,109 @@ void OSprocessRunner::executeOperation(const MetaCommand metaCmdObj, int process
             break;
         }
     }
+
+    return OP_DONE;
+}
+
+
+/**
+ * @brief      Runs the remaining cycles of a processing action.
+ * 
+ * Between cycles arrivals and I/O completions are delivered and the
+ * quantum is checked, as they are between operations. The action stops as
+ * soon as an interrupt that preempts the process is pending, so a long
+ * burst holds the CPU for at most one cycle past the interrupt.
+ *
+ * @param[in]  (const MetaCommand&) anOp  The processing action
+ * @param[in]  (int) cyclesDone           The cycles run before
+ * @param[in]  (int) processIndex         The process number
+ *
+ * @return     (int) The cycles run this time.
+ *
+ * @tparam     Policy  The scheduling algorithm, whose traits decide whether
+ *                     the quantum is checked and which interrupts preempt
+ */
+template <class Policy>
+int OSprocessRunner::runCycles(const MetaCommand& anOp, int cyclesDone, int processIndex) {
+    int cyclesLeft = anOp.getCycles() - cyclesDone;
+    if (cyclesLeft <= 0) {
+        countDown(0);
+        return 0;
+    }
+
+    int cyclesRun = 0;
+
+    while (true) {
+        countDown(anOp.getTimeOfCycles(1));
+
+        if (cache_.isEnabled() && (anOp.getWorkingSet() > 0)) {
+            accessWorkingSet(anOp, cyclesDone + cyclesRun, processIndex);
+        }
+
+        cyclesRun++;
+
+        // the interrupts after the last cycle are taken by the dispatcher
+        if (cyclesRun == cyclesLeft) {
+            break;
+        }
+
+        admitArrivals();
+        completeIORequests();
+
+        if (Policy::TIMED && clock_.isVirtual()) {
+            checkVirtualQuantum();
+        }
+
+        if (interrupts_.getPending() & Policy::PREEMPTING) {
+            break;
+        }
+    }
+
+    return cyclesRun;
 }
 
+/**
+ * @brief      Runs the working set accesses of one cycle of a processing
+ *             action through the caches, and waits for the time they took
+ *             beyond hitting the nearest level.
+ * 
+ * The cycle time in the configuration is the time of a cycle whose
+ * accesses all hit the nearest level, so a working set that fits there runs
+ * at its configured speed. A sequential working set is walked a line at a
+ * time, carrying on from the previous cycle; a random one is accessed at
+ * uniformly chosen lines.
+ *
+ * @param[in]  (const MetaCommand&) anOp  The processing action
+ * @param[in]  (int) cycle                The cycle of the action
+ * @param[in]  (int) processIndex         The process number
+ */
+void OSprocessRunner::accessWorkingSet(const MetaCommand& anOp, int cycle, int processIndex) {
+    long long numLines = anOp.getWorkingSet() * 1024LL / cache_.getLineSize();
+    long long stallNanos = 0;
+
+    if (numLines < 1) {
+        numLines = 1;
+    }
+
+    for (int i = 0; i < cacheAccesses_; i++) {
+        long long line;
+
+        if (anOp.getAccessPattern() == MetaCommand::RANDOM) {
+            line = rng_.nextBelow(numLines);
+        }
+        else {
+            line = ((long long)cycle * cacheAccesses_ + i) % numLines;
+        }
+
+        stallNanos += cache_.access(processIndex, line) - cache_.getHitTime(0);
+    }
+
+    if (stallNanos > 0) {
+        cacheStallNanos_ += stallNanos;
+        clock_.waitUntil(clock_.nowMicros() + ((stallNanos + 500) / 1000));
+        sampleMetrics();
+    }
+}
 
 /**
  * @brief      Logs an interruption to the process.
@@ -616,10 +1004,7 @@ void OSprocessRunner::logInterruption(int processIndex) {
     OperationInfo opInterruptInfo;
 
     // timestamp start
-    auto opInterruptstartTime = std::chrono::steady_clock::now();
-    std::chrono::duration<double> startDuration;
-    startDuration = (opInterruptstartTime - begin_);
-    opInterruptInfo.timeStamp = startDuration.count();
+    opInterruptInfo.timeStamp = clock_.nowSeconds();
 
     // Assign actor
     opInterruptInfo.actor = "Process " + std::to_string(processIndex);
@@ -630,6 +1015,9 @@ void OSprocessRunner::logInterruption(int processIndex) {
     } else if (schedCode_ == 1) {
         // assign description
         opInterruptInfo.opDescription = "Process interrupted by STR scheduling algorithm.";
+    } else if (schedCode_ == 2) {
+        // assign description
+        opInterruptInfo.opDescription = "Process interrupted by EDF scheduling algorithm.";
     }
 
     // Push operation onto vector
@@ -637,141 +1025,722 @@ void OSprocessRunner::logInterruption(int processIndex) {
 }
 
 /**
- * @brief      A function that creates the I/O thread to handle
- *             an I/O event.
+ * @brief      Logs an event with the current timestamp.
+ * 
+ * The log is added to the OperationInfo vector.
  *
- * @param[in]  (int) time  The total time taken by the I/O process 
- *                         in milliseconds.
- * @param[in]  (std::string) aDescriptor  Descriptor of operation
- * @param[in]  (std::string&) resource  The resource used for operation 
+ * @param[in]  (std::string) actor        The actor, "OS" or "Process N"
+ * @param[in]  (std::string) description  The event description
  */
-void OSprocessRunner::inputOutput(int time, std::string aDescriptor, std::string& resource) {
-    // Get IO time
-    ioTime_ = time;
+void OSprocessRunner::logEvent(std::string actor, std::string description) {
+    ScopedPhaseTimer timer("Record event");
 
-    // flag for i/o pperation completion initialized to false
-    ioComplete_ = false;
+    OperationInfo anEventInfo;
 
-    /*
-     * Call semaphore wait function for resource.
-     * When resource becomes available, lock the mutex protecting the resources.
-     * Copy the resource value and pop it from front of deque.
-     */
-    if (aDescriptor == "hard drive") {
-        sem_wait(&hardDriveSemaphore);
-        pthread_mutex_lock(&mutex1);
-        resource = hardDriveDeque.front();
-        hardDriveDeque.pop_front();
-    }
-    else if (aDescriptor == "keyboard") {
-        sem_wait(&keyboardSemaphore);
-        pthread_mutex_lock(&mutex1);
-        resource = keyboardDeque.front();
-        keyboardDeque.pop_front();
-    }
-    else if (aDescriptor == "scanner") {
-        sem_wait(&scannerSemaphore);
-        pthread_mutex_lock(&mutex1);
-        resource = scannerDeque.front();
-        scannerDeque.pop_front(); 
-    }
-    else if (aDescriptor == "monitor") {
-        sem_wait(&monitorSemaphore);
-        pthread_mutex_lock(&mutex1);
-        resource = monitorDeque.front();
-        monitorDeque.pop_front(); 
-    }
-    else if (aDescriptor == "projector") {
-        sem_wait(&projectorSemaphore);
-        pthread_mutex_lock(&mutex1);
-        resource = projectorDeque.front();
-        projectorDeque.pop_front(); 
-    }
-
-    // unlock the mutex
-    pthread_mutex_unlock(&mutex1);
-
-    // Call IO thread
-    pthread_t tid; /* the thread identifier */
-    pthread_attr_t attr; /* set of thread attributes */
-    /* get the default attributes */
-    pthread_attr_init(&attr);
-    /* create the thread with the static helper function */
-    pthread_create(&tid, &attr, &ioThreadHelper, this);
+    anEventInfo.timeStamp = clock_.nowSeconds();
+    anEventInfo.actor = actor;
+    anEventInfo.opDescription = description;
 
-    // // Change PCB state
-    // state_ = WAITING;
+    operationsVect_.push_back(anEventInfo);
+}
 
-    // Wait for IO thread to finish by polling shared
-    // variable ioComplete_
-    while(!ioComplete_) {}
+/**
+ * @brief      Gets the time the CPU has not been idle.
+ *
+ * @return     (long long) CPU busy microseconds since the simulation started.
+ */
+long long OSprocessRunner::busyMicros() const {
+    return clock_.nowMicros() - idleMicros_;
+}
 
-    /*
-     * Call semaphore post to signal that a resource has become available.
-     * Lock the mutex protecting the resources.
-     * Push the resource onto the back of the deque.
-     */
-    if (aDescriptor == "hard drive") {
-        sem_post(&hardDriveSemaphore);
-        pthread_mutex_lock(&mutex1);
-        hardDriveDeque.push_back(resource);
-    }
-    else if (aDescriptor == "keyboard") {
-        sem_post(&keyboardSemaphore);
-        pthread_mutex_lock(&mutex1);
-        keyboardDeque.push_back(resource);
-    }
-    else if (aDescriptor == "scanner") {
-        sem_post(&scannerSemaphore);
-        pthread_mutex_lock(&mutex1);
-        scannerDeque.push_back(resource); 
-    }
-    else if (aDescriptor == "monitor") {
-        sem_post(&monitorSemaphore);
-        pthread_mutex_lock(&mutex1);
-        monitorDeque.push_back(resource); 
-    }
-    else if (aDescriptor == "projector") {
-        sem_post(&projectorSemaphore);
-        pthread_mutex_lock(&mutex1);
-        projectorDeque.push_back(resource); 
+/**
+ * @brief      Switches the CPU to a process other than the last one to run
+ *             on it, charging the context switch time and the time to
+ *             refill the process's cache.
+ * 
+ * A process's cache cools as other processes run. It is cold if the process
+ * has not run before, and otherwise as cold as the share of the cache warm
+ * time that other processes have had the CPU since it left. With no warm
+ * time every switch finds the cache cold.
+ *
+ * @param      (Process&) aProcess  The process taking the CPU
+ */
+void OSprocessRunner::switchContext(Process& aProcess) {
+    long long refill = cacheRefillMicros_;
+
+    if ((aProcess.getLastRunEnd() >= 0) && (cacheWarmMicros_ > 0)) {
+        long long othersRan = busyMicros() - aProcess.getLastRunEnd();
+
+        if (othersRan < cacheWarmMicros_) {
+            refill = cacheRefillMicros_ * othersRan / cacheWarmMicros_;
+        }
     }
 
-    // unlock the mutex
-    pthread_mutex_unlock(&mutex1);
+    numContextSwitches_++;
+    switchMicros_ += contextSwitchMicros_;
+    refillMicros_ += refill;
+    lastProcess_ = aProcess.getProcessNumber();
 
-    // // Change PCB state
-    // state_ = READY;
+    if ((contextSwitchMicros_ + refill) > 0) {
+        clock_.waitUntil(clock_.nowMicros() + contextSwitchMicros_ + refill);
+        sampleMetrics();
+    }
 }
 
 /**
- * @brief      Helper function for I/O thread function.
- * 
- * Pthread.h was created for C not C++ so it has trouble accepting class
- * member functions. It cannot handle the 'this' pointer. This function
- * uses a static member function (which does not have a 'this' pointer)
- * to call the non-static member function used in the thread.
+ * @brief      Records when a process that has not finished leaves the CPU,
+ *             so that its cache can cool until it runs again.
  *
- * @param      (void*) obj   Pointer to the OSprocessRunner class calling
- *                           the function.
- *
- * @return     (void*)
+ * @param      (Process&) aProcess  The process leaving the CPU
  */
-void* OSprocessRunner::ioThreadHelper(void *obj) {
-    OSprocessRunner *myObj = reinterpret_cast<OSprocessRunner *>(obj);
-    myObj->ioThreadFunction();
-    return myObj;
+void OSprocessRunner::leaveCPU(Process& aProcess) {
+    aProcess.setLastRunEnd(busyMicros());
 }
 
-/** 
- * @brief      I/O thread function.
- * 
- * This function uses a thread to mimic an I/O process that is out
- * of the scope of the process calling it.
+/**
+ * @brief      Takes a process off the CPU to wait for memory. It is not
+ *             runnable again until memory is freed.
+ *
+ * @param[in]  (Process&) aProcess  The process that blocked
  */
-void OSprocessRunner::ioThreadFunction() {
+void OSprocessRunner::blockForMemory(Process& aProcess) {
+    aProcess.setPCBstate(Process::WAITING);
+    memoryWaitQ_.push_back(aProcess);
+}
+
+/**
+ * @brief      Moves processes waiting for memory back to the ready queue,
+ *             in the order they blocked, to retry the allocation.
+ *
+ * @param[in]  (int) count  The most processes to wake
+ */
+void OSprocessRunner::wakeMemoryWaiters(int count) {
+    if (memoryWaitQ_.empty() || (count < 1)) {
+        return;
+    }
+
+    // Get the ready queue mutex lock
+    context_.lockReadyQueue();
+
+    for (int i = 0; (i < count) && (!memoryWaitQ_.empty()); i++) {
+        memoryWaitQ_.front().setPCBstate(Process::READY);
+        readyQ_.insertProcess(memoryWaitQ_.front(), clock_.nowMicros());
+        memoryWaitQ_.pop_front();
+    }
+
+    // if STR or EDF sort ready queue
+    if (schedCode_ != 0) {
+        readyQ_.sortReadyQueue();
+    }
+
+    processesInRdyQ_ = readyQ_.getNumberOfProcesses();
+
+    // Release ready queue mutex lock
+    context_.unlockReadyQueue();
+}
+
+/**
+ * @brief      Moves a process to wait for the I/O request it just queued.
+ *
+ * @param      (Process&) aProcess          The process
+ * @param[in]  (const MetaCommand&) anOp    The queued operation
+ */
+void OSprocessRunner::blockForIO(Process& aProcess, const MetaCommand& anOp) {
+    IOWait aWait;
+
+    aProcess.setPCBstate(Process::WAITING);
+    aWait.process = aProcess;
+    aWait.code = anOp.getCode();
+    aWait.deviceIndex = anOp.getDeviceIndex();
+
+    ioWaitQ_[nextIORequest_] = aWait;
+    nextIORequest_++;
+}
+
+/**
+ * @brief      Moves the processes whose disk requests and batches have
+ *             finished back to the ready queue, in the order they finished
+ *             on each.
+ *
+ * @return     (int) The number of processes moved.
+ */
+int OSprocessRunner::completeIORequests() {
+    DiskScheduler::Completion aDiskCompletion;
+    IOBatcher::Completion aBatchCompletion;
+    int completed = 0;
+
+    while (disk_.popCompleted(clock_.nowMicros(), aDiskCompletion)) {
+        readyAfterIO(aDiskCompletion.id, "");
+        completed++;
+    }
+
+    while (batcher_.popCompleted(clock_.nowMicros(), aBatchCompletion)) {
+        readyAfterIO(aBatchCompletion.id,
+                     " on " + unitName(aBatchCompletion.device, aBatchCompletion.unit) +
+                     ", batch of " + std::to_string(aBatchCompletion.batchSize));
+        completed++;
+    }
+
+    if (completed > 0) {
+        interrupts_.raise(InterruptController::IO_COMPLETION);
+    }
+
+    return completed;
+}
+
+/**
+ * @brief      Logs the end of a queued I/O request and moves its process
+ *             back to the ready queue.
+ *
+ * @param[in]  (int) id                   The request id
+ * @param[in]  (std::string) description  Added to the end of the log line
+ */
+void OSprocessRunner::readyAfterIO(int id, std::string description) {
+    std::map<int, IOWait>::iterator waitIter = ioWaitQ_.find(id);
+    Process& aProcess = waitIter->second.process;
+    std::string direction = (waitIter->second.code == 'I') ? " input" : " output";
+
+    logEvent("Process " + std::to_string(aProcess.getProcessNumber()),
+             "end " + configObj_.getDevices().get(waitIter->second.deviceIndex).name +
+             direction + description);
+
+    // Get the ready queue mutex lock
+    context_.lockReadyQueue();
+
+    aProcess.setPCBstate(Process::READY);
+    readyQ_.insertProcess(aProcess, clock_.nowMicros());
+
+    // if STR or EDF sort ready queue
+    if (schedCode_ != 0) {
+        readyQ_.sortReadyQueue();
+    }
+
+    processesInRdyQ_ = readyQ_.getNumberOfProcesses();
+
+    // Release ready queue mutex lock
+    context_.unlockReadyQueue();
+
+    ioWaitQ_.erase(waitIter);
+}
+
+/**
+ * @brief      Checks for queued I/O requests that have not completed.
+ *
+ * @return     true if a disk request or a batch is pending.
+ */
+bool OSprocessRunner::hasPendingIO() const {
+    return disk_.hasPending() || batcher_.hasPending();
+}
+
+/**
+ * @brief      Writes the state of the simulation to the checkpoint file.
+ * 
+ * Called between processes, when every process is in the ready queue, a
+ * wait queue or the arrival schedule, and in virtual time, where no device
+ * unit is held between operations. The log so far is saved too, so a run
+ * restored from the checkpoint writes the whole log.
+ */
+void OSprocessRunner::saveCheckpoint() {
+    ScopedPhaseTimer timer("Save checkpoint");
+
+    std::string filePath = configObj_.getCheckpointFilePath();
+
+    checkpointDone_ = true;
+    logEvent("OS", "checkpoint written to " + filePath);
+
+    CheckpointWriter out(filePath);
+
+    clock_.save(out);
+    interrupts_.save(out);
+    rng_.save(out);
+    readyQ_.save(out);
+    arrivals_.save(out);
+
+    out.putInt(memoryMode_);
+    if (memoryMode_ == 1) {
+        pagedMemory_.save(out);
+    }
+    else {
+        memory_.save(out);
+    }
+
+    out.putBool(diskPolicy_ >= 0);
+    if (diskPolicy_ >= 0) {
+        disk_.save(out);
+    }
+
+    batcher_.save(out);
+    cache_.save(out);
+    metrics_.save(out);
+
+    out.putInt(memoryWaitQ_.size());
+    for (unsigned int i = 0; i < memoryWaitQ_.size(); i++) {
+        memoryWaitQ_[i].save(out);
+    }
+
+    out.putInt(ioWaitQ_.size());
+    for (std::map<int, IOWait>::const_iterator it = ioWaitQ_.begin(); it != ioWaitQ_.end(); ++it) {
+        out.putInt(it->first);
+        it->second.process.save(out);
+        out.putInt(it->second.code);
+        out.putInt(it->second.deviceIndex);
+    }
+
+    out.putInt(nextIORequest_);
+    out.putInt(numBlockedAllocations_);
+    out.putInt(numFailedAllocations_);
+    out.putInt(idleMicros_);
+    out.putInt(numIdlePeriods_);
+    out.putInt(lastProcess_);
+    out.putInt(numContextSwitches_);
+    out.putInt(switchMicros_);
+    out.putInt(refillMicros_);
+    out.putInt(cacheStallNanos_);
+
+    out.putInt(latenessMicros_.size());
+    for (unsigned int i = 0; i < latenessMicros_.size(); i++) {
+        out.putInt(latenessMicros_[i]);
+    }
+
+    out.putInt(readyWaitMicros_.size());
+    for (unsigned int i = 0; i < readyWaitMicros_.size(); i++) {
+        out.putInt(readyWaitMicros_[i]);
+    }
+    out.putInt(processesInSystem_);
+    out.putInt(maxProcessesInSystem_);
+    out.putBool(sliceArmed_);
+    out.putInt(sliceDeadline_);
+
+    out.putInt(operationsVect_.size());
+    for (unsigned int i = 0; i < operationsVect_.size(); i++) {
+        out.putDouble(operationsVect_[i].timeStamp);
+        out.putString(operationsVect_[i].actor);
+        out.putString(operationsVect_[i].opDescription);
+    }
+
+    out.close();
+}
+
+/**
+ * @brief      Replaces the state of the simulation with a checkpoint.
+ * 
+ * The memory and I/O devices are initialized from the configuration first.
+ * The checkpoint then fills them in, so the configuration may change what
+ * the restored run does next: the scheduling algorithm and quantum, the
+ * disk and page replacement policies, and more units of a device.
+ *
+ * @param[in]  (std::string) filePath  The checkpoint file path
+ */
+void OSprocessRunner::restoreCheckpoint(std::string filePath) {
+    ScopedPhaseTimer timer("Restore checkpoint");
+
+    CheckpointReader in(filePath);
+
+    clock_.restore(in);
+    interrupts_.restore(in);
+    rng_.restore(in);
+    readyQ_.restore(in);
+    arrivals_.restore(in);
+
+    if (in.getInt() != memoryMode_) {
+        // throw exception
+        throw std::logic_error("OSprocessRunner Class: Checkpoint Has A Different Memory Management");
+    }
+    if (memoryMode_ == 1) {
+        pagedMemory_.restore(in);
+    }
+    else {
+        memory_.restore(in);
+    }
+
+    if (in.getBool() != (diskPolicy_ >= 0)) {
+        // throw exception
+        throw std::logic_error("OSprocessRunner Class: Checkpoint Has A Different Disk Scheduling");
+    }
+    if (diskPolicy_ >= 0) {
+        disk_.restore(in);
+    }
+
+    batcher_.restore(in);
+    cache_.restore(in);
+    metrics_.restore(in);
+
+    memoryWaitQ_.assign(in.getInt(), Process());
+    for (unsigned int i = 0; i < memoryWaitQ_.size(); i++) {
+        memoryWaitQ_[i].restore(in);
+    }
+
+    ioWaitQ_.clear();
+    for (long long i = in.getInt(); i > 0; i--) {
+        IOWait& aWait = ioWaitQ_[in.getInt()];
+        aWait.process.restore(in);
+        aWait.code = (char)in.getInt();
+        aWait.deviceIndex = in.getInt();
+    }
+
+    nextIORequest_ = in.getInt();
+    numBlockedAllocations_ = in.getInt();
+    numFailedAllocations_ = in.getInt();
+    idleMicros_ = in.getInt();
+    numIdlePeriods_ = in.getInt();
+    lastProcess_ = in.getInt();
+    numContextSwitches_ = in.getInt();
+    switchMicros_ = in.getInt();
+    refillMicros_ = in.getInt();
+    cacheStallNanos_ = in.getInt();
+
+    latenessMicros_.resize(in.getInt());
+    for (unsigned int i = 0; i < latenessMicros_.size(); i++) {
+        latenessMicros_[i] = in.getInt();
+    }
+
+    readyWaitMicros_.resize(in.getInt());
+    for (unsigned int i = 0; i < readyWaitMicros_.size(); i++) {
+        readyWaitMicros_[i] = in.getInt();
+    }
+    processesInSystem_ = in.getInt();
+    maxProcessesInSystem_ = in.getInt();
+    sliceArmed_ = in.getBool();
+    sliceDeadline_ = in.getInt();
+
+    operationsVect_.resize(in.getInt());
+    for (unsigned int i = 0; i < operationsVect_.size(); i++) {
+        operationsVect_[i].timeStamp = in.getDouble();
+        operationsVect_[i].actor = in.getString();
+        operationsVect_[i].opDescription = in.getString();
+    }
+
+    // The checkpointed run may have used another scheduling algorithm
+    if (schedCode_ != 0) {
+        readyQ_.sortReadyQueue();
+    }
+    processesInRdyQ_ = readyQ_.getNumberOfProcesses();
+
+    checkpointDone_ = true;
+}
+
+/**
+ * @brief      References the pages of a process for a memory blocking
+ *             operation.
+ * 
+ * A page fault reads the page from a hard drive: the process holds a drive
+ * for one hard drive cycle, waiting for a free drive like any
+ * other hard drive input.
+ *
+ * @param[in]  (int) numReferences  The number of page references
+ * @param[in]  (int) processIndex   The process number
+ */
+void OSprocessRunner::referencePages(int numReferences, int processIndex) {
+    std::string actor = "Process " + std::to_string(processIndex);
+
+    for (int i = 0; i < numReferences; i++) {
+        int page = pagedMemory_.nextReference(processIndex);
+
+        if (!pagedMemory_.reference(processIndex, page)) {
+            continue;
+        }
+
+        double faultStart = clock_.nowSeconds();
+
+        int unit = inputOutput(configObj_.getDevices().get(hardDriveDevice_).cycleTime, hardDriveDevice_);
+
+        // Log the fault once the drive is known
+        OperationInfo opFaultInfo;
+        opFaultInfo.timeStamp = faultStart;
+        opFaultInfo.actor = actor;
+        opFaultInfo.opDescription = "page fault on page " + std::to_string(page) +
+                                    ", start hard drive input on " + unitName(hardDriveDevice_, unit);
+        operationsVect_.push_back(opFaultInfo);
+
+        logEvent(actor, "end page fault");
+
+        interrupts_.raise(InterruptController::PAGE_FAULT);
+    }
+}
+
+/**
+ * @brief      Fills the summary vector with the end of run metrics.
+ */
+void OSprocessRunner::buildSummary() {
+    ScopedPhaseTimer timer("Build summary");
+
+    summaryVect_.clear();
+
+    long long totalMicros = clock_.nowMicros();
+    SummaryInfo cpuItems[] = {
+        {"CPU busy time {msec}", (totalMicros - idleMicros_) / 1000.0},
+        {"CPU idle time {msec}", idleMicros_ / 1000.0},
+        {"CPU idle periods", (double)numIdlePeriods_},
+        {"CPU utilization {percent}",
+         (totalMicros > 0) ? (100.0 * (totalMicros - idleMicros_) / totalMicros) : 0}
+    };
+
+    summaryVect_.insert(summaryVect_.end(), cpuItems,
+                        cpuItems + (sizeof(cpuItems) / sizeof(cpuItems[0])));
+
+    if (!readyWaitMicros_.empty()) {
+        std::vector<long long> waits = readyWaitMicros_;
+        long numFinished = waits.size();
+        double totalWait = 0;
+
+        std::sort(waits.begin(), waits.end());
+
+        for (unsigned int i = 0; i < waits.size(); i++) {
+            totalWait += waits[i];
+        }
+
+        // the longest wait of each process, nearest rank percentiles
+        SummaryInfo waitItems[] = {
+            {"Ready wait per process max mean {msec}", totalWait / numFinished / 1000},
+            {"Ready wait per process max p95 {msec}", waits[(numFinished * 95 + 99) / 100 - 1] / 1000.0},
+            {"Ready wait per process max p99 {msec}", waits[(numFinished * 99 + 99) / 100 - 1] / 1000.0},
+            {"Ready wait max {msec}", waits[numFinished - 1] / 1000.0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), waitItems,
+                            waitItems + (sizeof(waitItems) / sizeof(waitItems[0])));
+    }
+
+    if (admissionLimit_ > 0) {
+        SummaryInfo admissionItems[] = {
+            {"Admission limit", (double)admissionLimit_},
+            {"Admission max processes in system", (double)maxProcessesInSystem_},
+            {"Admission held arrivals", (double)arrivals_.getNumHeld()},
+            {"Admission hold mean {msec}", arrivals_.getMeanHoldMicros() / 1000},
+            {"Admission hold max {msec}", arrivals_.getMaxHoldMicros() / 1000.0},
+            {"Admission rejected arrivals", (double)arrivals_.getNumRejected()}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), admissionItems,
+                            admissionItems + (sizeof(admissionItems) / sizeof(admissionItems[0])));
+    }
+
+    if ((contextSwitchMicros_ > 0) || (cacheRefillMicros_ > 0)) {
+        SummaryInfo switchItems[] = {
+            {"Context switches", (double)numContextSwitches_},
+            {"Context switch time {msec}", switchMicros_ / 1000.0},
+            {"Cache refill time {msec}", refillMicros_ / 1000.0},
+            {"Mean cache refill time {usec}",
+             (numContextSwitches_ > 0) ? ((double)refillMicros_ / numContextSwitches_) : 0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), switchItems,
+                            switchItems + (sizeof(switchItems) / sizeof(switchItems[0])));
+    }
+
+    if (memoryMode_ == 1) {
+        SummaryInfo pagedItems[] = {
+            {"Memory frames", (double)pagedMemory_.getNumFrames()},
+            {"Memory page references", (double)pagedMemory_.getReferences()},
+            {"Memory TLB hits", (double)pagedMemory_.getTLBHits()},
+            {"Memory TLB misses", (double)pagedMemory_.getTLBMisses()},
+            {"Memory page faults", (double)pagedMemory_.getPageFaults()},
+            {"Memory page evictions", (double)pagedMemory_.getEvictions()}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), pagedItems,
+                            pagedItems + (sizeof(pagedItems) / sizeof(pagedItems[0])));
+    }
+    else {
+        SummaryInfo items[] = {
+            {"Memory allocations", (double)memory_.getNumAllocations()},
+            {"Memory allocations blocked", (double)numBlockedAllocations_},
+            {"Memory allocations failed", (double)numFailedAllocations_},
+            {"Memory peak in use {kbytes}", (double)memory_.getPeakInUse()},
+            {"Memory peak internal fragmentation {kbytes}", (double)memory_.getPeakInternalFragmentation()},
+            {"Memory mean external fragmentation {percent}", 100 * memory_.getMeanExternalFragmentation()},
+            {"Memory max external fragmentation {percent}", 100 * memory_.getMaxExternalFragmentation()}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), items,
+                            items + (sizeof(items) / sizeof(items[0])));
+    }
+
+    if (diskPolicy_ >= 0) {
+        long numRequests = disk_.getNumRequests();
+        SummaryInfo diskItems[] = {
+            {"Disk requests", (double)numRequests},
+            {"Disk seek distance {tracks}", (double)disk_.getTotalSeekTracks()},
+            {"Disk mean seek distance {tracks}",
+             (numRequests > 0) ? ((double)disk_.getTotalSeekTracks() / numRequests) : 0},
+            {"Disk mean response time {msec}", disk_.getMeanResponseMicros() / 1000},
+            {"Disk max response time {msec}", disk_.getMaxResponseMicros() / 1000.0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), diskItems,
+                            diskItems + (sizeof(diskItems) / sizeof(diskItems[0])));
+    }
+
+    if (cache_.isEnabled()) {
+        for (int i = 0; i < cache_.getNumLevels(); i++) {
+            std::string level = "Cache " + cache_.getLevelName(i);
+            long accesses = cache_.getHits(i) + cache_.getMisses(i);
+            SummaryInfo levelItems[] = {
+                {level + " hits", (double)cache_.getHits(i)},
+                {level + " misses", (double)cache_.getMisses(i)},
+                {level + " hit rate {percent}",
+                 (accesses > 0) ? (100.0 * cache_.getHits(i) / accesses) : 0},
+                {level + " evictions by other processes", (double)cache_.getForeignEvictions(i)}
+            };
+
+            summaryVect_.insert(summaryVect_.end(), levelItems,
+                                levelItems + (sizeof(levelItems) / sizeof(levelItems[0])));
+        }
+
+        SummaryInfo cacheItems[] = {
+            {"Cache memory accesses", (double)cache_.getMemoryAccesses()},
+            {"Cache stall time {msec}", cacheStallNanos_ / 1000000.0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), cacheItems,
+                            cacheItems + (sizeof(cacheItems) / sizeof(cacheItems[0])));
+    }
+
+    if (!latenessMicros_.empty()) {
+        std::vector<long long> lateness = latenessMicros_;
+        long numMisses = 0;
+        double totalLateness = 0;
+
+        std::sort(lateness.begin(), lateness.end());
+
+        for (unsigned int i = 0; i < lateness.size(); i++) {
+            numMisses += (lateness[i] > 0) ? 1 : 0;
+            totalLateness += lateness[i];
+        }
+
+        // nearest rank percentiles, negative lateness is finishing early
+        long numDeadlines = lateness.size();
+        SummaryInfo deadlineItems[] = {
+            {"Deadline processes", (double)numDeadlines},
+            {"Deadline misses", (double)numMisses},
+            {"Deadline miss rate {percent}", 100.0 * numMisses / numDeadlines},
+            {"Lateness mean {msec}", totalLateness / numDeadlines / 1000},
+            {"Lateness min {msec}", lateness[0] / 1000.0},
+            {"Lateness p50 {msec}", lateness[(numDeadlines * 50 + 99) / 100 - 1] / 1000.0},
+            {"Lateness p95 {msec}", lateness[(numDeadlines * 95 + 99) / 100 - 1] / 1000.0},
+            {"Lateness p99 {msec}", lateness[(numDeadlines * 99 + 99) / 100 - 1] / 1000.0},
+            {"Lateness max {msec}", lateness[numDeadlines - 1] / 1000.0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), deadlineItems,
+                            deadlineItems + (sizeof(deadlineItems) / sizeof(deadlineItems[0])));
+    }
+
+    if (batcher_.getNumRequests() > 0) {
+        long numBatches = batcher_.getNumBatches();
+        SummaryInfo batchItems[] = {
+            {"I/O batched requests", (double)batcher_.getNumRequests()},
+            {"I/O batches", (double)numBatches},
+            {"I/O mean batch size",
+             (numBatches > 0) ? ((double)batcher_.getNumRequests() / numBatches) : 0},
+            {"I/O batch unit time {msec}", batcher_.getTotalServiceMicros() / 1000.0},
+            {"I/O unbatched unit time {msec}", batcher_.getTotalRequestedMicros() / 1000.0}
+        };
+
+        summaryVect_.insert(summaryVect_.end(), batchItems,
+                            batchItems + (sizeof(batchItems) / sizeof(batchItems[0])));
+    }
+}
+
+/**
+ * @brief      A function that creates the I/O thread to handle
+ *             an I/O event.
+ *
+ * @param[in]  (int) time  The total time taken by the I/O process 
+ *                         in milliseconds.
+ * @param[in]  (int) deviceIndex  Index of the device in the registry
+ *
+ * @return     (int) The number of the unit used for the operation.
+ */
+int OSprocessRunner::inputOutput(int time, int deviceIndex) {
+    // Get IO time
+    ioMicros_ = serviceTime(time);
+
+    // flag for i/o pperation completion initialized to false
+    ioComplete_ = false;
+
+    // The state of every device lives at its registry index
+    UnitFreeList& freeUnits = context_.getFreeUnits(deviceIndex);
+
+    // Take a free unit, parking until one is released if none are free
+    int unit = freeUnits.acquire();
+
+    if (clock_.isVirtual()) {
+        // In virtual time the I/O takes no real time
+        clock_.advance(ioMicros_);
+        ioComplete_ = true;
+    }
+    else {
+        // Call IO thread
+        pthread_t tid; /* the thread identifier */
+        pthread_attr_t attr; /* set of thread attributes */
+        /* get the default attributes */
+        pthread_attr_init(&attr);
+        /* create the thread with the static helper function */
+        pthread_create(&tid, &attr, &ioThreadHelper, this);
+
+        // Wait for IO thread to finish by polling shared
+        // variable ioComplete_
+        while(!ioComplete_) {}
+
+        pthread_join(tid, NULL);
+    }
+
+    // Sample while the unit is still busy
+    sampleMetrics();
+
+    // // Change PCB state
+    // state_ = WAITING;
+
+    // Return the unit, waking a parked thread if there is one
+    freeUnits.release(unit);
+
+    // // Change PCB state
+    // state_ = READY;
+
+    return unit;
+}
+
+/**
+ * @brief      Gets the name of a device unit for the log, e.g. "HDD_0".
+ *
+ * @param[in]  (int) deviceIndex  Index of the device in the registry
+ * @param[in]  (int) unit  The unit number
+ *
+ * @return     (std::string) The unit name.
+ */
+std::string OSprocessRunner::unitName(int deviceIndex, int unit) {
+    return configObj_.getDevices().get(deviceIndex).unitPrefix + "_" + std::to_string(unit);
+}
+
+/**
+ * @brief      Helper function for I/O thread function.
+ * 
+ * Pthread.h was created for C not C++ so it has trouble accepting class
+ * member functions. It cannot handle the 'this' pointer. This function
+ * uses a static member function (which does not have a 'this' pointer)
+ * to call the non-static member function used in the thread.
+ *
+ * @param      (void*) obj   Pointer to the OSprocessRunner class calling
+ *                           the function.
+ *
+ * @return     (void*)
+ */
+void* OSprocessRunner::ioThreadHelper(void *obj) {
+    OSprocessRunner *myObj = reinterpret_cast<OSprocessRunner *>(obj);
+    myObj->ioThreadFunction();
+    return myObj;
+}
+
+/** 
+ * @brief      I/O thread function.
+ * 
+ * This function uses a thread to mimic an I/O process that is out
+ * of the scope of the process calling it.
+ */
+void OSprocessRunner::ioThreadFunction() {
     // Get countdown time
-    countDownTime_ = ioTime_;
+    countDownMicros_ = ioMicros_;
 
     // Call countdown thread
     pthread_t tid; /* the thread identifier */
@@ -785,6 +1754,8 @@ void OSprocessRunner::ioThreadFunction() {
     // variable timerComplete_
     while(!timerComplete_) {}
 
+    pthread_join(tid, NULL);
+
     ioComplete_ = true;
 }
 
@@ -797,10 +1768,18 @@ void OSprocessRunner::ioThreadFunction() {
  */
 void OSprocessRunner::countDown(int time) {
     // Get countdown time
-    countDownTime_ = time;
+    countDownMicros_ = serviceTime(time);
 
     timerComplete_ = false;
 
+    // In virtual time the countdown takes no real time
+    if (clock_.isVirtual()) {
+        clock_.advance(countDownMicros_);
+        timerComplete_ = true;
+        sampleMetrics();
+        return;
+    }
+
     // Call countdown thread
     pthread_t tid; /* the thread identifier */
     pthread_attr_t attr; /* set of thread attributes */
@@ -812,6 +1791,33 @@ void OSprocessRunner::countDown(int time) {
     // Wait for countdown thread to finish by polling shared
     // variable timerComplete_
     while(!timerComplete_) {}
+
+    pthread_join(tid, NULL);
+
+    sampleMetrics();
+}
+
+/**
+ * @brief      Gets the service time of an operation.
+ * 
+ * With service time jitter the time is drawn uniformly within the jitter
+ * of its cycle time, from the simulation's random source. Without it no
+ * number is drawn, so the time is exactly the cycle time.
+ *
+ * @param[in]  (int) time  The cycle time in milliseconds.
+ *
+ * @return     (long long) The service time in microseconds.
+ */
+long long OSprocessRunner::serviceTime(int time) {
+    long long micros = time * 1000LL;
+
+    if ((serviceJitter_ == 0) || (micros == 0)) {
+        return micros;
+    }
+
+    double spread = (2 * rng_.nextUnit() - 1) * serviceJitter_ / 100.0;
+
+    return (long long)(micros * (1 + spread) + 0.5);
 }
 
 /**
@@ -838,7 +1844,7 @@ void* OSprocessRunner::countDownThreadHelper(void *obj) {
  */
 void OSprocessRunner::countDownThreadFunction() {
     std::chrono::steady_clock::time_point tend;
-    tend = std::chrono::steady_clock::now() + std::chrono::milliseconds(countDownTime_);
+    tend = std::chrono::steady_clock::now() + std::chrono::microseconds(countDownMicros_);
     while (std::chrono::steady_clock::now() < tend){}
 
     timerComplete_ = true;
@@ -849,13 +1855,32 @@ void OSprocessRunner::countDownThreadFunction() {
  *             time slice used in the round robin sched. alg.
  */
 void OSprocessRunner::quantumTimer() {
+    // In virtual time the quantum is checked by checkVirtualQuantum()
+    if (clock_.isVirtual()) {
+        return;
+    }
+
     // Call quantumTimer thread
-    pthread_t tid; /* the thread identifier */
     pthread_attr_t attr; /* set of thread attributes */
     /* get the default attributes */
     pthread_attr_init(&attr);
     /* create the thread using the static helpera function */
-    pthread_create(&tid, &attr, &quantumTimerHelper, this);
+    pthread_create(&timerTid_, &attr, &quantumTimerHelper, this);
+    timerStarted_ = true;
+}
+
+/**
+ * @brief      Stops the quantum timer thread, if it was started, and waits
+ *             for it to exit.
+ */
+void OSprocessRunner::stopQuantumTimer() {
+    if (!timerStarted_) {
+        return;
+    }
+
+    stopTimer_ = true;
+    pthread_join(timerTid_, NULL);
+    timerStarted_ = false;
 }
 
 /**
@@ -879,171 +1904,190 @@ void* OSprocessRunner::quantumTimerHelper(void *obj) {
 
 
 /**
- * @brief      Thread function to set the quantum timer flag for round robin
+ * @brief      Thread function to raise the quantum timer interrupt for round robin
  * 
  * This function has a waiting flag to ensure that the timer does not start
- * until an operation starts executing. When the timer is up, the round robin
- * flag is set.
+ * until an operation starts executing. When the timer is up, the timer
+ * interrupt is raised, unless the CPU went idle during the quantum. It runs until stopQuantumTimer() is called.
  * 
  */
 void OSprocessRunner::quantumTimerThreadFunction() {
-    while (true) {
-        // wait till start of operation
-        while(true) {
-            // Get the waitForOP mutex lock
-            pthread_mutex_lock(&waitForOP);
-
-            // check flag
-            if (!waitForOP_) {
-                // reset flag
-                waitForOP_ = true;
-                // Release the waitForOP mutex lock
-                pthread_mutex_unlock(&waitForOP);
-                // escape while loop
-                break;
+    while (!stopTimer_) {
+        // wait till start of operation, resetting the flag
+        while (waitForOP_.exchange(true)) {
+            if (stopTimer_) {
+                return;
             }
-
-            // Release the waitForOP mutex lock
-            pthread_mutex_unlock(&waitForOP);
         }
+        restartQuantum_ = false;
 
         std::chrono::steady_clock::time_point tend;
         tend = std::chrono::steady_clock::now() + std::chrono::milliseconds(quantumNumber_);
-        while (std::chrono::steady_clock::now() < tend){}
-
-        // Get the rrFlagLock mutex lock
-        pthread_mutex_lock(&rrFlagLock);
+        while ((std::chrono::steady_clock::now() < tend) && (!restartQuantum_)){}
 
-        rrFlag_ = true;
+        // the CPU went idle, the next operation starts a new quantum
+        if (restartQuantum_.exchange(false)) {
+            continue;
+        }
 
-        // Release the rrFlagLock mutex lock
-        pthread_mutex_unlock(&rrFlagLock);
+        interrupts_.raise(InterruptController::TIMER);
     }
 }
 
-
 /**
- * @brief      A function that creates a thread to load the MDF file
- *             every 100 ms for 10 times.
- *              
- */
-void OSprocessRunner::loadMDF() {
-    // Call loadMDF thread
-    pthread_t tid; /* the thread identifier */
-    pthread_attr_t attr; /* set of thread attributes */
-    /* get the default attributes */
-    pthread_attr_init(&attr);
-    /* create the thread using the static helper function */
-    pthread_create(&tid, &attr, &loadMDFHelper, this);
-}
-
-/**
- * @brief      Helper function for loadMDF thread function.
+ * @brief      Virtual time version of the quantum timer thread.
+ * 
+ * The quantum starts with the first operation after the last interrupt. When
+ * the clock passes the end of the quantum the timer interrupt is raised.
  * 
- * Pthread.h was created for C not C++ so it has trouble accepting class
- * member functions. It cannot handle the 'this' pointer. This function
- * uses a static member function (which does not have a 'this' pointer)
- * to call the non-static member function used in the thread.
- *
- * @param      (void*) obj   Pointer to the OSprocessRunner class calling
- *                           the function.
- *
- * @return     (void*)
  */
-void* OSprocessRunner::loadMDFHelper(void *obj) {
-    OSprocessRunner *myObj = reinterpret_cast<OSprocessRunner *>(obj);
-    myObj->loadMDFThreadFunction();
-    return myObj;
+void OSprocessRunner::checkVirtualQuantum() {
+    if (!sliceArmed_) {
+        // start the quantum with this operation
+        sliceArmed_ = true;
+        sliceDeadline_ = clock_.nowMicros() + (quantumNumber_ * 1000LL);
+    }
+    else if (clock_.nowMicros() >= sliceDeadline_) {
+        sliceArmed_ = false;
+
+        interrupts_.raise(InterruptController::TIMER);
+    }
 }
 
 
 /**
- * @brief      Loads the meta data file multiple times.
+ * @brief      Moves every process that has arrived by the current time
+ *             into the ready queue, as far as the admission limit allows.
+ * 
+ * Under the limit an arrival that finds the system full waits in the
+ * arrival schedule until a process finishes, or is rejected.
  * 
- * This function loads the metadata file 10 times, once every 100 ms.
- * When the metadata file is loaded onto the ready queue, the STR interrupt
- * flag is set.
+ * @return     (int) The number of processes that arrived.
  * 
  */
-void OSprocessRunner::loadMDFThreadFunction() {
-    int count = 0;
+int OSprocessRunner::admitArrivals() {
+    // Nothing due yet, avoid taking the lock
+    if ((!arrivals_.hasPending()) || (arrivals_.nextArrivalTime() > clock_.nowMicros())) {
+        return 0;
+    }
 
-    while (count < 10) {
-        std::chrono::steady_clock::time_point tend;
-        tend = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
-        while (std::chrono::steady_clock::now() < tend){}
+    // -1 for no limit
+    int room = -1;
+    if (admissionLimit_ > 0) {
+        room = std::max(0, admissionLimit_ - processesInSystem_);
 
-        // Get the rdyQLock mutex lock
-        pthread_mutex_lock(&rdyQLock);
+        if ((room == 0) && (admissionPolicy_ != 1)) {
+            arrivals_.holdDue(clock_.nowMicros());
+            return 0;
+        }
+    }
 
-        importMDF();
+    // Get the ready queue mutex lock
+    context_.lockReadyQueue();
 
-        // Release the rdyQLock mutex lock
-        pthread_mutex_unlock(&rdyQLock);
+    int arrived = arrivals_.deliverDue(clock_.nowMicros(), readyQ_, room, admissionPolicy_ == 2);
+    int rejected = (admissionPolicy_ == 1) ? arrivals_.rejectDue(clock_.nowMicros()) : 0;
 
-        // If STR 
-        if (schedCode_ == 1) {
-            // Get the strFlagLock mutex lock
-            pthread_mutex_lock(&strFlagLock);
+    if (arrived > 0) {
+        interrupts_.raise(InterruptController::ARRIVAL);
+    }
 
-            // set strInterruptFlag
-            strFlag_ = true;
+    // if STR or EDF sort ready queue
+    if (schedCode_ != 0) {
+        readyQ_.sortReadyQueue();
+    }
 
-            // release the strFlagLock mutex lock
-            pthread_mutex_unlock(&strFlagLock);
-        }
-        count++;
+    // get the size of ready queue while locked
+    processesInRdyQ_ = readyQ_.getNumberOfProcesses();
+
+    // Release the ready queue mutex lock
+    context_.unlockReadyQueue();
+
+    processesInSystem_ += arrived;
+    maxProcessesInSystem_ = std::max(maxProcessesInSystem_, processesInSystem_);
+
+    if (rejected > 0) {
+        logEvent("OS", ((rejected == 1) ? std::string("arrival") : (std::to_string(rejected) + " arrivals")) +
+                       " rejected, admission limit reached");
     }
+
+    return arrived;
 }
 
+/**
+ * @brief      Samples the queues, memory and devices for every interval
+ *             boundary the clock has passed. Called after every step of the
+ *             clock, before anything changes at the new time, so the state
+ *             is the one that held during the step.
+ */
+void OSprocessRunner::sampleMetrics() {
+    if (!metrics_.isDue(clock_.nowMicros())) {
+        return;
+    }
+
+    MetricsSampler::Sample state;
+    const DeviceRegistry& devices = configObj_.getDevices();
+
+    state.readyQueue = processesInRdyQ_;
+    state.waiting = memoryWaitQ_.size() + ioWaitQ_.size();
+    state.memoryInUse = (memoryMode_ == 1)
+                        ? (long)(pagedMemory_.getNumFrames() - pagedMemory_.getNumFreeFrames()) * memoryBlockSize_
+                        : memory_.getInUse();
+    state.completed = readyWaitMicros_.size();
+
+    for (int i = 0; i < devices.size(); i++) {
+        int busy = context_.getFreeUnits(i).getNumBusy() + batcher_.getNumBusy(i);
+
+        if ((diskPolicy_ >= 0) && (i == hardDriveDevice_)) {
+            busy += disk_.getNumBusy();
+        }
+
+        state.busyUnits.push_back(busy);
+    }
+
+    metrics_.record(state, clock_.nowMicros());
+}
 
 /**
- * @brief      Static function used to assign the number of system resources allocated
- *             to each i/o operation. The number of resources is optained from the
- *             configuration file. This function is static because number of resources
- *             will be the same for all processes, and it is initialized before an
- *             OSprocessRunner object is created.
+ * @brief      Checks for arrivals that could enter the system when they are
+ *             due. Arrivals held by the admission limit cannot until a
+ *             process finishes, so they are no event to wait for.
  *
- * @param[in]  rsc0  The rsc 0
- * @param[in]  rsc1  The rsc 1
- * @param[in]  rsc2  The rsc 2
- * @param[in]  rsc3  The rsc 3
- * @param[in]  rsc4  The rsc 4
+ * @return     (bool) True if an arrival is pending and there is room for it,
+ *             or it will be rejected.
  */
-void OSprocessRunner::fillResourceDeques(const int rsc0, const int rsc1, const int rsc2, const int rsc3, const int rsc4) {
-    // Initialize the static I/O mutex in OSprcessRunner class
-    mutex1 = PTHREAD_MUTEX_INITIALIZER;
+bool OSprocessRunner::hasAdmissibleArrival() const {
+    return arrivals_.hasPending() &&
+           ((admissionLimit_ == 0) || (processesInSystem_ < admissionLimit_) || (admissionPolicy_ == 1));
+}
 
-    // Initialize the static I/O semaphores in OSprcessRunner class
-    sem_init(&hardDriveSemaphore, 0, rsc0);
-    sem_init(&keyboardSemaphore, 0, rsc1);
-    sem_init(&scannerSemaphore, 0, rsc2);
-    sem_init(&monitorSemaphore, 0, rsc3);
-    sem_init(&projectorSemaphore, 0, rsc4);
 
-    // get the number of resources
-    sem_getvalue(&hardDriveSemaphore, &hardDriveResources);
-    sem_getvalue(&keyboardSemaphore, &keyboardResources);
-    sem_getvalue(&scannerSemaphore, &scannerResources);
-    sem_getvalue(&monitorSemaphore, &monitorResources);
-    sem_getvalue(&projectorSemaphore, &projectorResources);
+/**
+ * @brief      Records the contention on the simulation's locks and device
+ *             units. Call before runProcesses.
+ */
+void OSprocessRunner::enableLockStatistics() {
+    context_.enableLockStatistics();
+}
 
-    // Create the deques for each resource type
-    for (int i = 0; i < hardDriveResources; i++) {
-        hardDriveDeque.push_back("HDD_" + std::to_string(i));
-    }
-    for (int i = 0; i < keyboardResources; i++) {
-        keyboardDeque.push_back("KBRD_" + std::to_string(i));
-    }
-    for (int i = 0; i < scannerResources; i++) {
-        scannerDeque.push_back("SCNR_" + std::to_string(i));
-    }
-    for (int i = 0; i < monitorResources; i++) {
-        monitorDeque.push_back("MNTR_" + std::to_string(i));
-    }
-    for (int i = 0; i < projectorResources; i++) {
-        projectorDeque.push_back("PROJ_" + std::to_string(i));
-    }
+/**
+ * @brief      Writes the contention on the simulation's locks and device
+ *             units.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the statistics.
+ */
+void OSprocessRunner::writeLockStatistics(std::ostream& out) const {
+    context_.writeLockStatistics(out);
+}
+
+/**
+ * @brief      Gets the time series of the queues and devices.
+ *
+ * @return     (const MetricsSampler&) The samples.
+ */
+const MetricsSampler& OSprocessRunner::getMetrics() const {
+    return metrics_;
 }
 
 /**
@@ -1093,4 +2137,35 @@ int OSprocessRunner::getNumOperations() {
         return operationsVect_.size();
 }
 
+/**
+ * @brief      Gets the name of a summary metric.
+ *
+ * @param[in]  (int) index  The index of the metric in the summary vector
+ *
+ * @return     (std::string) The metric name with its unit.
+ */
+std::string OSprocessRunner::getSummaryMetric(const int index) {
+    return summaryVect_[index].metric;
+}
+
+/**
+ * @brief      Gets the value of a summary metric.
+ *
+ * @param[in]  (int) index  The index of the metric in the summary vector
+ *
+ * @return     (double) The metric value.
+ */
+double OSprocessRunner::getSummaryValue(const int index) {
+    return summaryVect_[index].value;
+}
+
+/**
+ * @brief      Gets the number of summary metrics.
+ *
+ * @return     (int) The number of metrics.
+ */
+int OSprocessRunner::getNumSummaryItems() {
+    return summaryVect_.size();
+}
+
 #endif
\ No newline at end of file
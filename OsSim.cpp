@@ -21,6 +21,8 @@
 // ReadyQueue.h included with MetaData.h
 // Process.h included with ReadyQueue.h
 // MetaCommand.h included with Process.h
+// PhaseProfiler.h included with Configuration.h
+// LockStatistics.h included with OSprocessRunner.h
 
 //FUNCTION PROTOTYPES
 void outputDisplay(std::chrono::duration<double> aDuration,
@@ -31,6 +33,10 @@ void outputDisplay(std::chrono::duration<double> aDuration,
  *             from a process run by OSprocessRunner to the
  *             log file method stated in the config file.
  *
+ * Options after the configuration file: --profile prints the real time
+ * spent in each phase of the simulator on exit, and --lock-stats prints
+ * the contention on each lock.
+ *
  * @param[in]  argc  (int) The number of command line arguments
  * @param      argv  (char const* []) Array of command line arguments
  *
@@ -52,18 +58,30 @@ int main(int argc, char const *argv[])
     // retrieve configuration file path
     std::string configFileName = argv[1];
 
+    // Time the simulator's own phases and locks if asked to
+    bool profiling = false;
+    bool lockStats = false;
+    for (int i = 2; i < argc; i++) {
+        profiling = profiling || (std::string(argv[i]) == "--profile");
+        lockStats = lockStats || (std::string(argv[i]) == "--lock-stats");
+    }
+
+    PhaseProfiler profiler;
+    if (profiling) {
+        PhaseProfiler::setCurrent(&profiler);
+    }
+
     // create Configuration object
     Configuration configObj;
 
     // Parse the configuration file with the Configuration object
     configObj.parseConfigFile(configFileName);
 
-    // Fill the resource deques (static member function)
-    OSprocessRunner::fillResourceDeques(configObj.getResourceSize(0),
-                                        configObj.getResourceSize(1),
-                                        configObj.getResourceSize(2),
-                                        configObj.getResourceSize(3),
-                                        configObj.getResourceSize(4));
+    // A virtual time simulation starts at exactly zero, so its log does
+    // not depend on how long the host took to get here
+    if (configObj.getClockMode() == 1) {
+        aDuration = std::chrono::duration<double>::zero();
+    }
 
     // Retrieve log file method from the Configuration object.
     int logFileMethod = configObj.getLogFileMethod();
@@ -72,10 +90,17 @@ int main(int argc, char const *argv[])
     // and the Configuration object.
     OSprocessRunner anApplication(begin, configObj);
 
+    if (lockStats) {
+        anApplication.enableLockStatistics();
+    }
+
     std::cout << std::endl << "Running Simulation..." << std::endl;
 
     // Run the OSprocessRunner
-    anApplication.runProcesses();
+    {
+        ScopedPhaseTimer timer("Run simulation");
+        anApplication.runProcesses();
+    }
 
     std::cout << std::endl << "Simulation Completed." << std::endl;
 
@@ -100,6 +125,25 @@ int main(int argc, char const *argv[])
 
         outToFile.close();
    }
+
+    // Time series of the queues and devices, next to the log
+    if (anApplication.getMetrics().isEnabled()) {
+        std::ofstream metricsFile(configObj.getMetricsFilePath().c_str());
+
+        anApplication.getMetrics().write(metricsFile);
+
+        metricsFile.close();
+    }
+
+    if (profiling) {
+        std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - begin;
+
+        PhaseProfiler::setCurrent(NULL);
+        profiler.report(std::cout, wallTime.count());
+    }
+    if (lockStats) {
+        anApplication.writeLockStatistics(std::cout);
+    }
     return 0;
 }
 
@@ -117,6 +161,7 @@ int main(int argc, char const *argv[])
 void outputDisplay(std::chrono::duration<double> aDuration,
                    OSprocessRunner& anApplication,
                    std::ostream& out) {
+    ScopedPhaseTimer timer("Write log");
 
     // Output the starting time
     out << std::fixed << std::showpoint << std::setprecision(6) 
@@ -129,4 +174,15 @@ void outputDisplay(std::chrono::duration<double> aDuration,
             << anApplication.getActor(index) << ": "
             << anApplication.getOpDescription(index) << std::endl;
     }
+
+    // Output the end of run summary, whole numbers without decimals
+    out << "Simulation summary:" << std::endl;
+    for (int index = 0; index < anApplication.getNumSummaryItems(); index++) {
+        double value = anApplication.getSummaryValue(index);
+        int precision = (value == (long long)value) ? 0 : 3;
+
+        out << "    " << anApplication.getSummaryMetric(index) << ": "
+            << std::fixed << std::noshowpoint << std::setprecision(precision)
+            << value << std::endl;
+    }
 }
\ No newline at end of file
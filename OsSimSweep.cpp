@@ -0,0 +1,134 @@
+/**
+ *  @file    OsSimSweep.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Parallel parameter sweep over simulator configurations
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <pthread.h>
+
+#include "ParameterSweep.h"
+// OSprocessRunner.h included with ParameterSweep.h
+
+//FUNCTION PROTOTYPES
+void printUsage(std::ostream& out);
+
+/**
+ * @brief      Runs every combination of the varied configuration commands
+ *             on a base configuration file and writes one table of the
+ *             summary metrics.
+ *
+ * @param[in]  argc  (int) The number of command line arguments
+ * @param      argv  (char const* []) Array of command line arguments
+ *
+ * @return     (int) 0 on success, 1 on a usage error, 2 if a point failed
+ */
+int main(int argc, char const *argv[])
+{
+    ParameterSweep sweep;
+    std::string tableFilePath;
+    int numThreads = 4;
+
+    if ((argc < 2) || (std::string(argv[1]) == "-h") || (std::string(argv[1]) == "--help")) {
+        printUsage((argc < 2) ? std::cerr : std::cout);
+        return (argc < 2) ? 1 : 0;
+    }
+
+    try {
+        // create Configuration object for the base of every point
+        Configuration configObj;
+        configObj.parseConfigFile(argv[1]);
+        sweep.setBaseConfiguration(configObj);
+
+        // every option takes exactly one value
+        for (int i = 2; i < argc; i += 2) {
+            std::string option = argv[i];
+
+            if ((i + 1) >= argc) {
+                std::cerr << "Missing value for " << option << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            }
+
+            std::string value = argv[i + 1];
+
+            if (option == "--quantum") sweep.addRange("Quantum Number {msec}", value);
+            else if (option == "--sched") sweep.addRange("CPU Scheduling Code", value);
+            else if (option == "--memory") sweep.addRange("System memory {kbytes}", value);
+            else if (option == "--threads") numThreads = atoi(value.c_str());
+            else if (option == "--out") tableFilePath = value;
+            else if (option == "--vary") {
+                // COMMAND=VALUES, the command may hold spaces and braces
+                std::string::size_type split = value.rfind('=');
+
+                if ((split == std::string::npos) || (split == 0)) {
+                    std::cerr << "Expected COMMAND=VALUES for --vary" << std::endl;
+                    return 1;
+                }
+
+                sweep.addRange(value.substr(0, split), value.substr(split + 1));
+            }
+            else {
+                std::cerr << "Unknown option " << option << std::endl;
+                printUsage(std::cerr);
+                return 1;
+            }
+        }
+
+        sweep.setNumThreads(numThreads);
+    }
+    catch (const std::logic_error& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Running " << sweep.getNumPoints() << " simulations on "
+              << numThreads << " threads..." << std::endl;
+
+    sweep.run();
+
+    if (tableFilePath.empty()) {
+        sweep.writeTable(std::cout);
+    }
+    else {
+        std::ofstream outToFile(tableFilePath.c_str());
+        sweep.writeTable(outToFile);
+        outToFile.close();
+    }
+
+    std::cout << "Sweep Completed";
+    if (sweep.getNumFailed() > 0) {
+        std::cout << ", " << sweep.getNumFailed() << " failed";
+    }
+    std::cout << "." << std::endl;
+
+    return (sweep.getNumFailed() > 0) ? 2 : 0;
+}
+
+
+/**
+ * @brief      Prints the command line options.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the usage.
+ */
+void printUsage(std::ostream& out) {
+    out << "Usage: ./OsSimSweep CONFIG [options]" << std::endl
+        << "  --quantum VALUES       Quantum Number {msec}" << std::endl
+        << "  --sched VALUES         CPU Scheduling Code" << std::endl
+        << "  --memory VALUES        System memory {kbytes}" << std::endl
+        << "  --vary COMMAND=VALUES  any configuration command, e.g." << std::endl
+        << "                         \"Hard drive quantity=1:4\"" << std::endl
+        << "  --threads N            worker threads (default 4)" << std::endl
+        << "  --out FILE             results table (default standard output)" << std::endl
+        << std::endl
+        << "VALUES is a list A,B,C or an integer range LO:HI or LO:HI:STEP" << std::endl
+        << "Every point runs in virtual time; the table is comma separated." << std::endl;
+}
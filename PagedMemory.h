@@ -0,0 +1,558 @@
+/**
+ *  @file    PagedMemory.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _PAGED_MEMORY
+#define _PAGED_MEMORY
+
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for demand-paged virtual memory.
+ *
+ * Every process has a page table that maps its pages to physical frames.
+ * Pages are created by M{allocate} and only get a frame the first time they
+ * are referenced. A reference looks in a small fully associative TLB first,
+ * then in the page table, and a page that is not resident is a page fault:
+ * a free frame is used if there is one, otherwise the replacement policy
+ * picks a victim frame to evict. Frames are shared by all processes, so
+ * resident processes evict each other's pages.
+ */
+class PagedMemory
+{
+public:
+    // Page replacement policy enum
+    enum Policy {FIFO, LRU, CLOCK};
+
+    // Default Constructor
+    PagedMemory() {
+        pageSize_ = 1;
+        policy_ = FIFO;
+        tlbSize_ = 0;
+        useCounter_ = 0;
+        clockHand_ = 0;
+        numFreeFrames_ = 0;
+        tlbHits_ = 0;
+        tlbMisses_ = 0;
+        pageFaults_ = 0;
+        evictions_ = 0;
+        references_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(int numFrames, int pageSize, Policy policy, int tlbSize);
+    long allocatePage(int owner);
+    int nextReference(int owner);
+    bool reference(int owner, int page);
+    void releaseProcess(int owner);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+    // GETTER FUNCTIONS
+    int getNumFrames() const;
+    int getNumFreeFrames() const;
+    int getNumResidentProcesses() const;
+    long getTLBHits() const;
+    long getTLBMisses() const;
+    long getPageFaults() const;
+    long getEvictions() const;
+    long getReferences() const;
+
+private:
+    // Struct for a page table entry
+    struct PageEntry {
+        int frame; // -1 if not resident
+    };
+
+    // Struct for the pages of one process
+    struct PageTable {
+        std::vector<PageEntry> pages;
+        int cursor; // next page referenced by M{block}
+        int resident; // pages with a frame
+    };
+
+    // Struct for a physical frame
+    struct Frame {
+        int owner; // -1 if free
+        int page;
+        long long loadTime; // for FIFO
+        long long lastUse; // for LRU
+        bool referenced; // for CLOCK
+    };
+
+    // Struct for a TLB entry
+    struct TLBEntry {
+        int owner; // -1 if empty
+        int page;
+        long long lastUse;
+    };
+
+    // PRIVATE DATA
+    int pageSize_; // kbytes per page, the memory block size
+    Policy policy_;
+    int tlbSize_;
+    std::vector<Frame> frames_;
+    std::vector<TLBEntry> tlb_;
+    std::unordered_map<int, PageTable> tables_; // page tables by owner
+    long long useCounter_; // logical time of references
+    int clockHand_;
+    int numFreeFrames_;
+    long tlbHits_;
+    long tlbMisses_;
+    long pageFaults_;
+    long evictions_;
+    long references_;
+
+    // PRIVATE FUNCTIONS
+    PageTable& tableFor(int owner);
+    int findFrame();
+    int chooseVictim();
+    void evict(int frame);
+    void tlbInsert(int owner, int page);
+    void tlbRemove(int owner, int page);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets up the frames and the TLB.
+ *
+ * @param[in]  numFrames  (int) The number of physical frames
+ * @param[in]  pageSize   (int) The page size in kbytes
+ * @param[in]  policy     (Policy) The page replacement policy
+ * @param[in]  tlbSize    (int) The number of TLB entries, may be zero
+ */
+void PagedMemory::initialize(int numFrames, int pageSize, Policy policy, int tlbSize) {
+    if (numFrames < 1) {
+        // throw exception
+        throw std::logic_error("PagedMemory Class: Number of Frames is Less Than One");
+    }
+
+    pageSize_ = pageSize;
+    policy_ = policy;
+    tlbSize_ = tlbSize;
+    clockHand_ = 0;
+    numFreeFrames_ = numFrames;
+    tables_.clear();
+
+    Frame freeFrame = {-1, 0, 0, 0, false};
+    frames_.assign(numFrames, freeFrame);
+
+    TLBEntry emptyEntry = {-1, 0, 0};
+    tlb_.assign(tlbSize, emptyEntry);
+}
+
+/**
+ * @brief      Adds a page to a process's address space. The page gets a frame
+ *             when it is first referenced.
+ *
+ * @param[in]  owner  (int) The process number
+ *
+ * @return     (long) The virtual address of the page in kbytes.
+ */
+long PagedMemory::allocatePage(int owner) {
+    PageTable& table = tableFor(owner);
+    PageEntry anEntry = {-1};
+
+    table.pages.push_back(anEntry);
+
+    return (long)(table.pages.size() - 1) * pageSize_;
+}
+
+/**
+ * @brief      Gets the next page an M{block} references. Processes sweep
+ *             their pages in order, starting again after the last.
+ *
+ * @param[in]  owner  (int) The process number
+ *
+ * @return     (int) The page number.
+ */
+int PagedMemory::nextReference(int owner) {
+    PageTable& table = tableFor(owner);
+    int page = table.cursor;
+
+    table.cursor = (table.cursor + 1) % table.pages.size();
+
+    return page;
+}
+
+/**
+ * @brief      References a page, bringing it into a frame if needed.
+ *
+ * @param[in]  owner  (int) The process number
+ * @param[in]  page   (int) The page number
+ *
+ * @return     true if the reference was a page fault.
+ */
+bool PagedMemory::reference(int owner, int page) {
+    useCounter_++;
+    references_++;
+
+    // TLB lookup
+    for (int i = 0; i < tlbSize_; i++) {
+        if ((tlb_[i].owner == owner) && (tlb_[i].page == page)) {
+            tlbHits_++;
+            tlb_[i].lastUse = useCounter_;
+
+            int frame = tableFor(owner).pages[page].frame;
+            frames_[frame].lastUse = useCounter_;
+            frames_[frame].referenced = true;
+            return false;
+        }
+    }
+    tlbMisses_++;
+
+    // Page table walk
+    PageTable& table = tableFor(owner);
+    int frame = table.pages[page].frame;
+    bool fault = (frame < 0);
+
+    if (fault) {
+        pageFaults_++;
+
+        frame = findFrame();
+        frames_[frame].owner = owner;
+        frames_[frame].page = page;
+        frames_[frame].loadTime = useCounter_;
+        table.pages[page].frame = frame;
+        table.resident++;
+    }
+
+    frames_[frame].lastUse = useCounter_;
+    frames_[frame].referenced = true;
+    tlbInsert(owner, page);
+
+    return fault;
+}
+
+/**
+ * @brief      Frees the frames, TLB entries and page table of a process.
+ *
+ * @param[in]  owner  (int) The process number
+ */
+void PagedMemory::releaseProcess(int owner) {
+    std::unordered_map<int, PageTable>::iterator tableIter = tables_.find(owner);
+
+    if (tableIter == tables_.end()) {
+        return;
+    }
+
+    std::vector<PageEntry>& pages = tableIter->second.pages;
+
+    for (unsigned int page = 0; page < pages.size(); page++) {
+        if (pages[page].frame >= 0) {
+            frames_[pages[page].frame].owner = -1;
+            numFreeFrames_++;
+        }
+        tlbRemove(owner, page);
+    }
+
+    tables_.erase(tableIter);
+}
+
+/**
+ * @brief      Gets the page table of a process, creating it with one page
+ *             (the process's code) on first use.
+ *
+ * @param[in]  owner  (int) The process number
+ *
+ * @return     (PageTable&) The page table.
+ */
+PagedMemory::PageTable& PagedMemory::tableFor(int owner) {
+    std::unordered_map<int, PageTable>::iterator tableIter = tables_.find(owner);
+
+    if (tableIter != tables_.end()) {
+        return tableIter->second;
+    }
+
+    PageTable& table = tables_[owner];
+    PageEntry anEntry = {-1};
+    table.pages.push_back(anEntry);
+    table.cursor = 0;
+    table.resident = 0;
+
+    return table;
+}
+
+/**
+ * @brief      Gets a frame for a faulting page, evicting a victim if none
+ *             are free.
+ *
+ * @return     (int) The frame number.
+ */
+int PagedMemory::findFrame() {
+    if (numFreeFrames_ > 0) {
+        for (unsigned int frame = 0; frame < frames_.size(); frame++) {
+            if (frames_[frame].owner < 0) {
+                numFreeFrames_--;
+                return frame;
+            }
+        }
+    }
+
+    int victim = chooseVictim();
+    evict(victim);
+
+    return victim;
+}
+
+/**
+ * @brief      Chooses the frame to evict with the replacement policy.
+ *
+ * FIFO = the frame that was filled longest ago
+ * LRU = the frame referenced longest ago
+ * CLOCK = the first frame after the hand whose reference bit is clear,
+ *         clearing reference bits as the hand passes
+ *
+ * @return     (int) The frame number.
+ */
+int PagedMemory::chooseVictim() {
+    switch (policy_) {
+        case FIFO:
+        {
+            int victim = 0;
+            for (unsigned int frame = 1; frame < frames_.size(); frame++) {
+                if (frames_[frame].loadTime < frames_[victim].loadTime) {
+                    victim = frame;
+                }
+            }
+            return victim;
+        }
+        case LRU:
+        {
+            int victim = 0;
+            for (unsigned int frame = 1; frame < frames_.size(); frame++) {
+                if (frames_[frame].lastUse < frames_[victim].lastUse) {
+                    victim = frame;
+                }
+            }
+            return victim;
+        }
+        case CLOCK:
+        {
+            while (frames_[clockHand_].referenced) {
+                frames_[clockHand_].referenced = false;
+                clockHand_ = (clockHand_ + 1) % frames_.size();
+            }
+            int victim = clockHand_;
+            clockHand_ = (clockHand_ + 1) % frames_.size();
+            return victim;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      Takes a frame away from the page that holds it.
+ *
+ * @param[in]  frame  (int) The frame number
+ */
+void PagedMemory::evict(int frame) {
+    int owner = frames_[frame].owner;
+    int page = frames_[frame].page;
+    PageTable& table = tableFor(owner);
+
+    table.pages[page].frame = -1;
+    table.resident--;
+    tlbRemove(owner, page);
+    evictions_++;
+}
+
+/**
+ * @brief      Adds a translation to the TLB, replacing the least recently
+ *             used entry.
+ *
+ * @param[in]  owner  (int) The process number
+ * @param[in]  page   (int) The page number
+ */
+void PagedMemory::tlbInsert(int owner, int page) {
+    if (tlbSize_ == 0) {
+        return;
+    }
+
+    int slot = 0;
+    for (int i = 0; i < tlbSize_; i++) {
+        if (tlb_[i].owner < 0) {
+            slot = i;
+            break;
+        }
+        if (tlb_[i].lastUse < tlb_[slot].lastUse) {
+            slot = i;
+        }
+    }
+
+    tlb_[slot].owner = owner;
+    tlb_[slot].page = page;
+    tlb_[slot].lastUse = useCounter_;
+}
+
+/**
+ * @brief      Removes a translation from the TLB if it is there.
+ *
+ * @param[in]  owner  (int) The process number
+ * @param[in]  page   (int) The page number
+ */
+void PagedMemory::tlbRemove(int owner, int page) {
+    for (int i = 0; i < tlbSize_; i++) {
+        if ((tlb_[i].owner == owner) && (tlb_[i].page == page)) {
+            tlb_[i].owner = -1;
+            return;
+        }
+    }
+}
+
+int PagedMemory::getNumFrames() const {
+    return frames_.size();
+}
+
+int PagedMemory::getNumFreeFrames() const {
+    return numFreeFrames_;
+}
+
+/**
+ * @brief      Gets the number of processes with at least one resident page.
+ *
+ * @return     (int) The number of processes.
+ */
+int PagedMemory::getNumResidentProcesses() const {
+    int resident = 0;
+
+    for (std::unordered_map<int, PageTable>::const_iterator iter = tables_.begin();
+         iter != tables_.end(); ++iter) {
+        if (iter->second.resident > 0) {
+            resident++;
+        }
+    }
+
+    return resident;
+}
+
+long PagedMemory::getTLBHits() const {
+    return tlbHits_;
+}
+
+long PagedMemory::getTLBMisses() const {
+    return tlbMisses_;
+}
+
+long PagedMemory::getPageFaults() const {
+    return pageFaults_;
+}
+
+long PagedMemory::getEvictions() const {
+    return evictions_;
+}
+
+long PagedMemory::getReferences() const {
+    return references_;
+}
+
+/**
+ * @brief      Writes the frames, the TLB, the page tables and the
+ *             statistics to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void PagedMemory::save(CheckpointWriter& out) const {
+    out.putInt(pageSize_);
+    out.putInt(policy_);
+
+    out.putInt(frames_.size());
+    for (unsigned int i = 0; i < frames_.size(); i++) {
+        out.putInt(frames_[i].owner);
+        out.putInt(frames_[i].page);
+        out.putInt(frames_[i].loadTime);
+        out.putInt(frames_[i].lastUse);
+        out.putBool(frames_[i].referenced);
+    }
+
+    out.putInt(tlb_.size());
+    for (unsigned int i = 0; i < tlb_.size(); i++) {
+        out.putInt(tlb_[i].owner);
+        out.putInt(tlb_[i].page);
+        out.putInt(tlb_[i].lastUse);
+    }
+
+    out.putInt(tables_.size());
+    for (std::unordered_map<int, PageTable>::const_iterator it = tables_.begin(); it != tables_.end(); ++it) {
+        out.putInt(it->first);
+        out.putInt(it->second.cursor);
+        out.putInt(it->second.resident);
+        out.putInt(it->second.pages.size());
+        for (unsigned int i = 0; i < it->second.pages.size(); i++) {
+            out.putInt(it->second.pages[i].frame);
+        }
+    }
+
+    out.putInt(useCounter_);
+    out.putInt(clockHand_);
+    out.putInt(numFreeFrames_);
+    out.putInt(tlbHits_);
+    out.putInt(tlbMisses_);
+    out.putInt(pageFaults_);
+    out.putInt(evictions_);
+    out.putInt(references_);
+}
+
+/**
+ * @brief      Reads the paged memory from a checkpoint, replacing its state.
+ *             The replacement policy is kept from initialize(), so a
+ *             restored run can try another policy.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void PagedMemory::restore(CheckpointReader& in) {
+    pageSize_ = in.getInt();
+    in.getInt(); // the policy of the checkpointed run
+
+    frames_.resize(in.getInt());
+    for (unsigned int i = 0; i < frames_.size(); i++) {
+        frames_[i].owner = in.getInt();
+        frames_[i].page = in.getInt();
+        frames_[i].loadTime = in.getInt();
+        frames_[i].lastUse = in.getInt();
+        frames_[i].referenced = in.getBool();
+    }
+
+    tlb_.resize(in.getInt());
+    tlbSize_ = tlb_.size();
+    for (unsigned int i = 0; i < tlb_.size(); i++) {
+        tlb_[i].owner = in.getInt();
+        tlb_[i].page = in.getInt();
+        tlb_[i].lastUse = in.getInt();
+    }
+
+    tables_.clear();
+    for (long long i = in.getInt(); i > 0; i--) {
+        PageTable& table = tables_[in.getInt()];
+        table.cursor = in.getInt();
+        table.resident = in.getInt();
+        table.pages.resize(in.getInt());
+        for (unsigned int j = 0; j < table.pages.size(); j++) {
+            table.pages[j].frame = in.getInt();
+        }
+    }
+
+    useCounter_ = in.getInt();
+    clockHand_ = in.getInt();
+    numFreeFrames_ = in.getInt();
+    tlbHits_ = in.getInt();
+    tlbMisses_ = in.getInt();
+    pageFaults_ = in.getInt();
+    evictions_ = in.getInt();
+    references_ = in.getInt();
+}
+
+#endif
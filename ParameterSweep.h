@@ -0,0 +1,359 @@
+/**
+ *  @file    ParameterSweep.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _PARAMETER_SWEEP
+#define _PARAMETER_SWEEP
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+#include <regex>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <pthread.h>
+
+#include "OSprocessRunner.h"
+
+
+/**
+ * @brief      Class for a grid of configurations run as independent
+ *             simulations on a pool of worker threads.
+ *
+ * Each varied command takes a list of values, and the grid is every
+ * combination of them, the first command varying slowest. Every point is
+ * the base configuration with its values set, run in virtual time. The
+ * results are written in grid order, whatever order the points finish in.
+ */
+class ParameterSweep
+{
+public:
+    // Default Constructor
+    ParameterSweep() {
+        numThreads_ = 1;
+        nextPoint_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void setBaseConfiguration(const Configuration& configObj);
+    void setNumThreads(int numThreads);
+    void addRange(std::string command, std::string values);
+    void run();
+    void writeTable(std::ostream& out) const;
+
+    // GETTER FUNCTIONS
+    int getNumPoints() const;
+    int getNumFailed() const;
+
+private:
+    // Struct for a command and the values it takes
+    struct Range {
+        std::string command;
+        std::vector<std::string> values;
+    };
+
+    // Struct for the results of one point of the grid
+    struct Result {
+        std::string error; // empty if the simulation ran
+        double simulatedTime; // seconds, the time stamp of the last operation
+        std::vector<std::string> metrics;
+        std::vector<double> values;
+    };
+
+    // PRIVATE DATA
+    Configuration baseConfig_;
+    int numThreads_;
+    std::vector<Range> ranges_;
+    std::vector<Result> results_; // indexed by point
+    std::atomic<int> nextPoint_; // next point for a worker to take
+
+    // PRIVATE FUNCTIONS
+    std::vector<std::string> valuesAt(int point) const;
+    void runPoint(int point);
+    void workerFunction();
+    static void* workerHelper(void *obj);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Sets the configuration every point starts from.
+ *
+ * @param[in]  configObj  (const Configuration&) The parsed base configuration
+ */
+void ParameterSweep::setBaseConfiguration(const Configuration& configObj) {
+    baseConfig_ = configObj;
+}
+
+void ParameterSweep::setNumThreads(int numThreads) {
+    if (numThreads < 1) {
+        // throw exception
+        throw std::logic_error("ParameterSweep Class: Number of Threads is Less Than One");
+    }
+
+    numThreads_ = numThreads;
+}
+
+/**
+ * @brief      Adds a command to vary.
+ *
+ * Values are a comma separated list (RR,STR) or an integer range LO:HI or
+ * LO:HI:STEP (10:50:10 is 10, 20, 30, 40, 50).
+ *
+ * @param[in]  command  (std::string) The configuration command
+ * @param[in]  values   (std::string) The values
+ */
+void ParameterSweep::addRange(std::string command, std::string values) {
+    std::regex rangeRE("^(-?[0-9]+):(-?[0-9]+)(?::([0-9]+))?$");
+    std::smatch collectedInfo;
+    Range aRange;
+
+    aRange.command = command;
+
+    if (std::regex_match(values, collectedInfo, rangeRE)) {
+        long low = atol(collectedInfo.str(1).c_str());
+        long high = atol(collectedInfo.str(2).c_str());
+        long step = collectedInfo[3].matched ? atol(collectedInfo.str(3).c_str()) : 1;
+
+        if ((step < 1) || (high < low)) {
+            // throw exception
+            throw std::logic_error("ParameterSweep Class: Invalid Range For " + command);
+        }
+
+        for (long value = low; value <= high; value += step) {
+            aRange.values.push_back(std::to_string(value));
+        }
+    }
+    else {
+        std::stringstream stream(values);
+        std::string value;
+
+        while (std::getline(stream, value, ',')) {
+            if (!value.empty()) {
+                aRange.values.push_back(value);
+            }
+        }
+    }
+
+    if (aRange.values.empty()) {
+        // throw exception
+        throw std::logic_error("ParameterSweep Class: No Values For " + command);
+    }
+
+    ranges_.push_back(aRange);
+}
+
+/**
+ * @brief      Gets the number of points in the grid.
+ *
+ * @return     (int) The product of the number of values of each command.
+ */
+int ParameterSweep::getNumPoints() const {
+    int numPoints = 1;
+
+    for (unsigned int i = 0; i < ranges_.size(); i++) {
+        numPoints *= ranges_[i].values.size();
+    }
+
+    return numPoints;
+}
+
+/**
+ * @brief      Gets the values of each varied command at a point.
+ *
+ * @param[in]  point  (int) The point, 0 to getNumPoints() - 1
+ *
+ * @return     (std::vector<std::string>) The values, in the order the
+ *             commands were added.
+ */
+std::vector<std::string> ParameterSweep::valuesAt(int point) const {
+    std::vector<std::string> values(ranges_.size());
+
+    // the last command varies fastest
+    for (int i = ranges_.size() - 1; i >= 0; i--) {
+        int numValues = ranges_[i].values.size();
+
+        values[i] = ranges_[i].values[point % numValues];
+        point /= numValues;
+    }
+
+    return values;
+}
+
+/**
+ * @brief      Runs every point of the grid on the worker threads and waits
+ *             for them to finish.
+ */
+void ParameterSweep::run() {
+    Result notRun = {"", 0, std::vector<std::string>(), std::vector<double>()};
+
+    results_.assign(getNumPoints(), notRun);
+    nextPoint_ = 0;
+
+    std::vector<pthread_t> workers(numThreads_);
+
+    for (int i = 0; i < numThreads_; i++) {
+        pthread_attr_t attr; /* set of thread attributes */
+        /* get the default attributes */
+        pthread_attr_init(&attr);
+        /* create the thread using the static helper function */
+        pthread_create(&workers[i], &attr, &workerHelper, this);
+    }
+
+    for (int i = 0; i < numThreads_; i++) {
+        pthread_join(workers[i], NULL);
+    }
+}
+
+/**
+ * @brief      Helper function for the worker thread function.
+ *
+ * @param      (void*) obj   Pointer to the ParameterSweep object
+ *
+ * @return     (void*)
+ */
+void* ParameterSweep::workerHelper(void *obj) {
+    ParameterSweep *mySweep = reinterpret_cast<ParameterSweep *>(obj);
+    mySweep->workerFunction();
+    return mySweep;
+}
+
+/**
+ * @brief      Worker thread function. Takes points until none are left.
+ */
+void ParameterSweep::workerFunction() {
+    int numPoints = results_.size();
+    int point;
+
+    while ((point = nextPoint_++) < numPoints) {
+        runPoint(point);
+    }
+}
+
+/**
+ * @brief      Runs the simulation of one point and keeps its summary. An
+ *             invalid configuration or meta data file is recorded as the
+ *             point's error.
+ *
+ * @param[in]  point  (int) The point
+ */
+void ParameterSweep::runPoint(int point) {
+    Result& aResult = results_[point];
+    std::vector<std::string> values = valuesAt(point);
+
+    try {
+        Configuration configObj = baseConfig_;
+
+        for (unsigned int i = 0; i < ranges_.size(); i++) {
+            configObj.setCommand(ranges_[i].command, values[i]);
+        }
+        configObj.setCommand("Simulation clock", "Virtual Time");
+
+        OSprocessRunner anApplication(std::chrono::steady_clock::now(), configObj);
+        anApplication.runProcesses();
+
+        int numOperations = anApplication.getNumOperations();
+        aResult.simulatedTime = (numOperations > 0) ? anApplication.getTimeStamp(numOperations - 1) : 0;
+
+        for (int i = 0; i < anApplication.getNumSummaryItems(); i++) {
+            aResult.metrics.push_back(anApplication.getSummaryMetric(i));
+            aResult.values.push_back(anApplication.getSummaryValue(i));
+        }
+    }
+    catch (const std::exception& error) {
+        aResult.error = error.what();
+    }
+}
+
+/**
+ * @brief      Gets the number of points whose simulation failed.
+ *
+ * @return     (int) The number of points with an error.
+ */
+int ParameterSweep::getNumFailed() const {
+    int numFailed = 0;
+
+    for (unsigned int i = 0; i < results_.size(); i++) {
+        if (!results_[i].error.empty()) {
+            numFailed++;
+        }
+    }
+
+    return numFailed;
+}
+
+/**
+ * @brief      Writes the results as comma separated values: one column per
+ *             varied command, the simulated time, every summary metric
+ *             reported by any point (blank where a point has none), and the
+ *             error of a failed point.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the table.
+ */
+void ParameterSweep::writeTable(std::ostream& out) const {
+    // the metrics in the order they first appear
+    std::vector<std::string> metrics;
+
+    for (unsigned int p = 0; p < results_.size(); p++) {
+        for (unsigned int m = 0; m < results_[p].metrics.size(); m++) {
+            bool found = false;
+            for (unsigned int i = 0; i < metrics.size(); i++) {
+                found = found || (metrics[i] == results_[p].metrics[m]);
+            }
+            if (!found) {
+                metrics.push_back(results_[p].metrics[m]);
+            }
+        }
+    }
+
+    // header
+    for (unsigned int i = 0; i < ranges_.size(); i++) {
+        out << "\"" << ranges_[i].command << "\",";
+    }
+    out << "\"Simulated time {sec}\"";
+    for (unsigned int i = 0; i < metrics.size(); i++) {
+        out << ",\"" << metrics[i] << "\"";
+    }
+    out << ",\"Error\"" << std::endl;
+
+    // one row per point
+    out << std::fixed << std::setprecision(6);
+
+    for (unsigned int p = 0; p < results_.size(); p++) {
+        const Result& aResult = results_[p];
+        std::vector<std::string> values = valuesAt(p);
+
+        for (unsigned int i = 0; i < values.size(); i++) {
+            out << "\"" << values[i] << "\",";
+        }
+
+        if (aResult.error.empty()) {
+            out << aResult.simulatedTime;
+        }
+
+        for (unsigned int i = 0; i < metrics.size(); i++) {
+            out << ",";
+            for (unsigned int m = 0; m < aResult.metrics.size(); m++) {
+                if (aResult.metrics[m] == metrics[i]) {
+                    out << aResult.values[m];
+                    break;
+                }
+            }
+        }
+
+        out << ",\"" << aResult.error << "\"" << std::endl;
+    }
+}
+
+#endif
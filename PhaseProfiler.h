@@ -0,0 +1,163 @@
+/**
+ *  @file    PhaseProfiler.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _PHASE_PROFILER
+#define _PHASE_PROFILER
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+
+
+/**
+ * @brief      Class for the real time the simulator itself spends in each of
+ *             its phases.
+ *
+ * A profiler is made current on one thread, and every ScopedPhaseTimer on
+ * that thread adds its time and a call to its phase. With no current
+ * profiler a timer does nothing but check for one, so the timers stay in
+ * the code at almost no cost. Phases may nest, so their times can add up to
+ * more than the run.
+ */
+class PhaseProfiler
+{
+public:
+    // PUBLIC FUNCTIONS
+    static PhaseProfiler* current();
+    static void setCurrent(PhaseProfiler* profiler);
+    void add(const char* phase, long long nanos);
+    void report(std::ostream& out, double wallSeconds) const;
+
+private:
+    // Struct for the totals of one phase
+    struct Phase {
+        const char* name;
+        long calls;
+        long long nanos;
+    };
+
+    // PRIVATE DATA
+    std::vector<Phase> phases_; // in the order first timed
+
+    // PRIVATE FUNCTIONS
+    static PhaseProfiler*& currentSlot();
+};
+
+/**
+ * @brief      Class for timing one scope as a phase of the current profiler.
+ *
+ * The phase name must be a string literal, it is kept by pointer.
+ */
+class ScopedPhaseTimer
+{
+public:
+    // OVERLOADED CONSTRUCTOR
+    explicit ScopedPhaseTimer(const char* phase)
+        : profiler_(PhaseProfiler::current()), phase_(phase) {
+        if (profiler_ != NULL) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Destructor
+    ~ScopedPhaseTimer() {
+        if (profiler_ != NULL) {
+            profiler_->add(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - start_).count());
+        }
+    }
+
+private:
+    // A timer belongs to its scope
+    ScopedPhaseTimer(const ScopedPhaseTimer&);
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&);
+
+    // PRIVATE DATA
+    PhaseProfiler* profiler_; // NULL when not profiling
+    const char* phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Gets the slot holding this thread's current profiler.
+ *
+ * @return     (PhaseProfiler*&) The slot, NULL when not profiling.
+ */
+PhaseProfiler*& PhaseProfiler::currentSlot() {
+    static thread_local PhaseProfiler* profiler = NULL;
+    return profiler;
+}
+
+PhaseProfiler* PhaseProfiler::current() {
+    return currentSlot();
+}
+
+/**
+ * @brief      Makes a profiler the one the timers on this thread add to.
+ *
+ * @param      profiler  (PhaseProfiler*) The profiler, NULL to stop profiling
+ */
+void PhaseProfiler::setCurrent(PhaseProfiler* profiler) {
+    currentSlot() = profiler;
+}
+
+/**
+ * @brief      Adds one call of a phase.
+ *
+ * @param[in]  phase  (const char*) The phase name
+ * @param[in]  nanos  (long long) The real time of the call
+ */
+void PhaseProfiler::add(const char* phase, long long nanos) {
+    // there are few phases, and a phase is nearly always the same literal
+    for (unsigned int i = 0; i < phases_.size(); i++) {
+        if ((phases_[i].name == phase) || (std::strcmp(phases_[i].name, phase) == 0)) {
+            phases_[i].calls++;
+            phases_[i].nanos += nanos;
+            return;
+        }
+    }
+
+    Phase aPhase = {phase, 1, nanos};
+    phases_.push_back(aPhase);
+}
+
+/**
+ * @brief      Writes the calls, total and mean time of every phase, and its
+ *             share of the run.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the breakdown.
+ * @param[in]  wallSeconds  (double) The real time of the whole run
+ */
+void PhaseProfiler::report(std::ostream& out, double wallSeconds) const {
+    out << "Simulator profile, " << std::fixed << std::setprecision(3)
+        << (wallSeconds * 1000) << " ms real time:" << std::endl;
+    out << "    " << std::left << std::setw(28) << "Phase" << std::right
+        << std::setw(12) << "Calls" << std::setw(14) << "Total {msec}"
+        << std::setw(14) << "Mean {usec}" << std::setw(18) << "Share {percent}" << std::endl;
+
+    for (unsigned int i = 0; i < phases_.size(); i++) {
+        const Phase& aPhase = phases_[i];
+
+        out << "    " << std::left << std::setw(28) << aPhase.name << std::right
+            << std::setw(12) << aPhase.calls
+            << std::setw(14) << (aPhase.nanos / 1e6)
+            << std::setw(14) << (aPhase.nanos / 1e3 / aPhase.calls)
+            << std::setw(18) << ((wallSeconds > 0) ? (aPhase.nanos / 1e7 / wallSeconds) : 0)
+            << std::endl;
+    }
+}
+
+#endif
@@ -10,6 +10,8 @@
 #define _PROCESS
 
 #include <vector>
+#include <memory>
+#include <stdexcept>
 
 #include "MetaCommand.h"
 
@@ -18,6 +20,12 @@
  * @brief      A class to store and retrieve information about a 
  *             process as well as the operations (MetaCommand objects) 
  *             of that process.
+ *
+ * A process is its progress through its operations (the operation index,
+ * cycles done and time remaining) plus a pointer to the operations, which
+ * are shared by every copy of the process and copied only if a shared copy
+ * is changed. Copying a process onto a queue, or holding it while it waits,
+ * costs the same however many operations it has.
  */
 class Process
 {
@@ -29,35 +37,67 @@ public:
     int getNumberOfCommands() const;
     int getNumberOfIOops() const;
     int getOpIndex() const;
+    int getCyclesDone() const;
     MetaCommand getMetaCommand(int index) const;
+    const MetaCommand& getCurrentCommand() const;
     int getPCBstate() const;
     int getProcessTimeRemain() const;
     int getProcessNumber() const;
+    long long getArrivalTime() const;
+    long long getLastRunEnd() const;
+    int getRelativeDeadline() const;
+    long long getDeadline() const;
+    long long getReadySince() const;
+    long long getMaxReadyWait() const;
 
     // SETTER FUNCTIONS
     void insertCommand(MetaCommand cmdObj);
     void setNumIOops(int numOps);
     void setProcessNumber(int pNumber);
     void incrementOpIndex();
+    void addCyclesDone(int cycles);
     void setPCBstate(PCB state);
     void addProcessTimeRemain(int time);
     void subtractProcessTimeRemain(int time);
+    void setArrivalTime(long long micros);
+    void setLastRunEnd(long long micros);
+    void setRelativeDeadline(int msec);
+    void setReadySince(long long micros);
+    void recordReadyWait(long long micros);
+
+    // PUBLIC FUNCTIONS
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
 
     // Default Constructor
     Process() {
         numIOoperations_ = 0;
         operationIndex_ = 0;
+        cyclesDone_ = 0;
         processTimeRemaining_ = 0;
+        arrivalTime_ = -1;
+        lastRunEnd_ = -1;
+        relativeDeadline_ = -1;
+        readySince_ = 0;
+        maxReadyWait_ = 0;
+        state_ = START;
+        processNumber_ = 0;
     }
 
 private:
     // PRIVATE DATA
-    std::vector<MetaCommand> metaCmdVect_;
+    std::shared_ptr<std::vector<MetaCommand> > program_; // the operations, NULL if none
     int numIOoperations_;
     int operationIndex_;
+    int cyclesDone_; // cycles of the current operation run before it was preempted
     PCB state_;
     int processTimeRemaining_;
     int processNumber_;
+    long long arrivalTime_; // microseconds from simulation start, -1 if not set
+    long long lastRunEnd_; // CPU busy microseconds when it last left the CPU, -1 if it has not run
+    int relativeDeadline_; // milliseconds after arrival to finish by, -1 for none
+    long long readySince_; // microseconds, when it last entered the ready queue
+    long long maxReadyWait_; // microseconds, longest time it has waited in the ready queue
 };
 
 //******************************************************************************
@@ -74,7 +114,7 @@ int Process::getProcessNumber() const {
  * @return     (int) The number of operations.
  */
 int Process::getNumberOfCommands() const {
-    return metaCmdVect_.size();
+    return program_ ? program_->size() : 0;
 }
 
 
@@ -105,11 +145,26 @@ int Process::getOpIndex() const {
  * @return     (MetaCommand) The MetaCommand object holding the information about the command
  */
 MetaCommand Process::getMetaCommand(int index) const {
-    MetaCommand tempMetaCmd = metaCmdVect_.at(index); // at(i) throws exception if i out-of-bounds
+    if (!program_) {
+        // throw exception
+        throw std::out_of_range("Process Class: Process Has No Operations");
+    }
+
+    MetaCommand tempMetaCmd = program_->at(index); // at(i) throws exception if i out-of-bounds
 
     return tempMetaCmd;
 }
 
+/**
+ * @brief      Gets the operation at the operation index without copying it.
+ *             Only valid while the process is not changed or copied over.
+ *
+ * @return     (const MetaCommand&) The current operation.
+ */
+const MetaCommand& Process::getCurrentCommand() const {
+    return (*program_)[operationIndex_];
+}
+
 int Process::getPCBstate() const {
     return state_;
 }
@@ -128,8 +183,16 @@ void Process::setProcessNumber(int pNumber) {
  * @param[in]  cmdObj (MetaCommand) The MetaCommand object.
  */
 void Process::insertCommand(MetaCommand cmdObj) {
+    // copy the operations first if another process shares them
+    if (!program_) {
+        program_.reset(new std::vector<MetaCommand>());
+    }
+    else if (program_.use_count() > 1) {
+        program_.reset(new std::vector<MetaCommand>(*program_));
+    }
+
     // push_back MetaCommand object onto the vector.
-    metaCmdVect_.push_back(cmdObj);
+    program_->push_back(cmdObj);
 }
 
 
@@ -144,6 +207,21 @@ void Process::setNumIOops(int numOps) {
 
 void Process::incrementOpIndex() {
     operationIndex_++;
+    cyclesDone_ = 0;
+}
+
+/**
+ * @brief      Gets the cycles of the current operation that have run, so
+ *             that a preempted operation resumes where it stopped.
+ *
+ * @return     (int) The cycles run, 0 if the operation has not started.
+ */
+int Process::getCyclesDone() const {
+    return cyclesDone_;
+}
+
+void Process::addCyclesDone(int cycles) {
+    cyclesDone_ += cycles;
 }
 
 void Process::setPCBstate(PCB state) {
@@ -158,4 +236,152 @@ void Process::subtractProcessTimeRemain(int time) {
     processTimeRemaining_ -= time;
 }
 
+/**
+ * @brief      Gets the arrival time of the process.
+ *
+ * @return     (long long) Microseconds from the start of the simulation,
+ *             or -1 if no arrival time was given.
+ */
+long long Process::getArrivalTime() const {
+    return arrivalTime_;
+}
+
+/**
+ * @brief      Sets the arrival time of the process.
+ *
+ * @param[in]  micros  (long long) Microseconds from the start of the simulation
+ */
+void Process::setArrivalTime(long long micros) {
+    arrivalTime_ = micros;
+}
+
+/**
+ * @brief      Gets when the process last left the CPU, measured in CPU busy
+ *             time so that the work of other processes since then is the
+ *             difference from the busy time now.
+ *
+ * @return     (long long) CPU busy microseconds, or -1 if the process has
+ *             not run.
+ */
+long long Process::getLastRunEnd() const {
+    return lastRunEnd_;
+}
+
+void Process::setLastRunEnd(long long micros) {
+    lastRunEnd_ = micros;
+}
+
+int Process::getRelativeDeadline() const {
+    return relativeDeadline_;
+}
+
+/**
+ * @brief      Gets the time the process should finish by.
+ *
+ * @return     (long long) Microseconds from the start of the simulation, its
+ *             arrival time plus its relative deadline, or -1 if it has no
+ *             deadline.
+ */
+long long Process::getDeadline() const {
+    if (relativeDeadline_ < 0) {
+        return -1;
+    }
+
+    return ((arrivalTime_ > 0) ? arrivalTime_ : 0) + relativeDeadline_ * 1000LL;
+}
+
+/**
+ * @brief      Sets the deadline of the process, relative to its arrival.
+ *
+ * @param[in]  msec  (int) Milliseconds after arrival, -1 for none
+ */
+void Process::setRelativeDeadline(int msec) {
+    relativeDeadline_ = msec;
+}
+
+long long Process::getReadySince() const {
+    return readySince_;
+}
+
+/**
+ * @brief      Gets the longest time the process has waited in the ready
+ *             queue at once.
+ *
+ * @return     (long long) The wait in microseconds.
+ */
+long long Process::getMaxReadyWait() const {
+    return maxReadyWait_;
+}
+
+void Process::setReadySince(long long micros) {
+    readySince_ = micros;
+}
+
+/**
+ * @brief      Records a wait in the ready queue, keeping the longest.
+ *
+ * @param[in]  micros  (long long) The wait in microseconds
+ */
+void Process::recordReadyWait(long long micros) {
+    if (micros > maxReadyWait_) {
+        maxReadyWait_ = micros;
+    }
+}
+
+/**
+ * @brief      Writes the process, its commands and its progress through
+ *             them to a checkpoint. The commands are shared with the other
+ *             processes running the same program, and written only with the
+ *             first of them.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void Process::save(CheckpointWriter& out) const {
+    if (out.putShared(program_.get())) {
+        out.putInt(program_->size());
+        for (unsigned int i = 0; i < program_->size(); i++) {
+            (*program_)[i].save(out);
+        }
+    }
+
+    out.putInt(numIOoperations_);
+    out.putInt(operationIndex_);
+    out.putInt(cyclesDone_);
+    out.putInt(state_);
+    out.putInt(processTimeRemaining_);
+    out.putInt(processNumber_);
+    out.putInt(arrivalTime_);
+    out.putInt(lastRunEnd_);
+    out.putInt(relativeDeadline_);
+    out.putInt(readySince_);
+    out.putInt(maxReadyWait_);
+}
+
+/**
+ * @brief      Reads the process from a checkpoint, sharing its commands
+ *             with the processes read before it that ran the same program.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void Process::restore(CheckpointReader& in) {
+    if (in.getShared(program_)) {
+        program_->resize(in.getInt());
+        for (unsigned int i = 0; i < program_->size(); i++) {
+            (*program_)[i].restore(in);
+        }
+    }
+
+    numIOoperations_ = in.getInt();
+    operationIndex_ = in.getInt();
+    cyclesDone_ = in.getInt();
+    state_ = (PCB)in.getInt();
+    processTimeRemaining_ = in.getInt();
+    processNumber_ = in.getInt();
+    arrivalTime_ = in.getInt();
+    lastRunEnd_ = in.getInt();
+    relativeDeadline_ = in.getInt();
+    readySince_ = in.getInt();
+    maxReadyWait_ = in.getInt();
+}
+
 #endif
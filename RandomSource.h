@@ -0,0 +1,116 @@
+/**
+ *  @file    RandomSource.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _RANDOM_SOURCE
+#define _RANDOM_SOURCE
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <sstream>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      A seeded source of random numbers.
+ *
+ * std::mt19937_64 produces the same sequence on every standard library, but
+ * the std:: distribution classes do not. All conversions from raw engine
+ * output are done here so that a seed always produces the same sequence.
+ */
+class RandomSource
+{
+public:
+    // OVERLOADED CONSTRUCTOR
+    explicit RandomSource(uint64_t seed) : engine_(seed) {}
+
+    // PUBLIC FUNCTIONS
+    double nextUnit();
+    double nextOpenUnit();
+    uint64_t nextBelow(uint64_t bound);
+    double nextExponential(double mean);
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+private:
+    // PRIVATE DATA
+    std::mt19937_64 engine_;
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Gets a uniform double in [0, 1).
+ *
+ * @return     (double) The value.
+ */
+double RandomSource::nextUnit() {
+    // top 53 bits fill the mantissa exactly
+    return (engine_() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief      Gets a uniform double in (0, 1), safe to pass to log() and pow().
+ *
+ * @return     (double) The value.
+ */
+double RandomSource::nextOpenUnit() {
+    return ((engine_() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief      Gets a uniform integer in [0, bound).
+ *
+ * @param[in]  bound  (uint64_t) The exclusive upper bound, must be above zero
+ *
+ * @return     (uint64_t) The value.
+ */
+uint64_t RandomSource::nextBelow(uint64_t bound) {
+    // reject the short tail so every value is equally likely
+    uint64_t limit = UINT64_MAX - (UINT64_MAX % bound);
+    uint64_t value = engine_();
+
+    while (value >= limit) {
+        value = engine_();
+    }
+
+    return value % bound;
+}
+
+/**
+ * @brief      Gets an exponentially distributed double.
+ *
+ * @param[in]  mean  (double) The mean of the distribution
+ *
+ * @return     (double) The value.
+ */
+double RandomSource::nextExponential(double mean) {
+    return -mean * std::log(nextOpenUnit());
+}
+
+/**
+ * @brief      Writes the state of the engine to a checkpoint, in the text
+ *             form the standard defines for it.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void RandomSource::save(CheckpointWriter& out) const {
+    std::ostringstream state;
+    state << engine_;
+    out.putString(state.str());
+}
+
+void RandomSource::restore(CheckpointReader& in) {
+    std::istringstream state(in.getString());
+    state >> engine_;
+}
+
+#endif
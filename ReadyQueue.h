@@ -9,9 +9,12 @@
 #ifndef _READY_QUEUE
 #define _READY_QUEUE
 
-#include <vector>
+#include <deque>
+#include <algorithm>
+#include <utility>
 
 #include "Process.h"
+#include "PhaseProfiler.h"
 
 
 /**
@@ -32,21 +35,32 @@ public:
     int getProcessArrivalIndx() const;
 
     // SETTER FUNCTIONS
-    void insertProcess(Process aProcess);
+    void insertProcess(Process aProcess, long long now);
     Process removeProcess();
     void setSchedAlgorithm(int schedCode);
+    void setAging(int percent);
     void sortReadyQueue();
     void incrementProcessArrivalIndx();
 
+    // PUBLIC FUNCTIONS
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
     // Default constructor
     ReadyQueue() {
         processArrivalIndx_ = 1;
+        agingPercent_ = 0;
     }
 
 private:
-    std::vector<Process> processVect_; // vector of processes
-    int schedCode_; // 0 is RR, 1 is STR
+    std::deque<Process> processVect_; // queue of processes, removed from the front
+    int schedCode_; // 0 is RR, 1 is STR, 2 is EDF
     int processArrivalIndx_; // for the process index
+    int agingPercent_; // STR: percent of the time waited taken off the time remaining
+
+    // PRIVATE FUNCTIONS
+    static bool earlierDeadline(const Process& first, const Process& second);
+    long long agedKey(const Process& aProcess) const;
 };
 
 //******************************************************************************
@@ -122,12 +136,29 @@ void ReadyQueue::incrementProcessArrivalIndx() {
 
 
 /**
- * @brief      Inserts a process into the back of the queue.
+ * @brief      Inserts a process into the back of the queue, or in order of
+ *             aged time remaining under STR with aging.
  *
  * @param[in]  aProcess  (Process) A process
+ * @param[in]  now       (long long) The time it became ready in microseconds
  */
-void ReadyQueue::insertProcess(Process aProcess) {
-    processVect_.push_back(aProcess);
+void ReadyQueue::insertProcess(Process aProcess, long long now) {
+    ScopedPhaseTimer timer("Ready queue insert");
+
+    aProcess.setReadySince(now);
+
+    if ((schedCode_ == 1) && (agingPercent_ > 0)) {
+        std::deque<Process>::iterator position =
+            std::upper_bound(processVect_.begin(), processVect_.end(), aProcess,
+                             [this](const Process& first, const Process& second) {
+                                 return agedKey(first) < agedKey(second);
+                             });
+
+        processVect_.insert(position, std::move(aProcess));
+        return;
+    }
+
+    processVect_.push_back(std::move(aProcess));
 }
 
 
@@ -137,17 +168,13 @@ void ReadyQueue::insertProcess(Process aProcess) {
  * @return     (Process) A process.
  */
 Process ReadyQueue::removeProcess() {
-    // temp process object
-    Process tempProcessObj;
+    ScopedPhaseTimer timer("Ready queue remove");
 
-    // Create iterator to first process in ready queue
-    std::vector<Process>::iterator beginIter = processVect_.begin();
-
-    // copy first process into temp by assigning dereferenced iterator
-    tempProcessObj = *beginIter;
+    // move first process into temp
+    Process tempProcessObj = std::move(processVect_.front());
 
     // Delete the first process from the ready queue
-    processVect_.erase(beginIter);
+    processVect_.pop_front();
 
     // return the process object
     return tempProcessObj;
@@ -165,13 +192,59 @@ void ReadyQueue::setSchedAlgorithm(int schedCode) {
 
 
 /**
- * @brief      Sorts the ready queue by shortest time remaining in the processes.
+ * @brief      Sets the aging of STR.
+ *
+ * A process that has waited w ms is ordered as if its time remaining were
+ * lower by percent / 100 * w ms, so a long process cannot wait forever
+ * behind newly arrived short ones.
+ *
+ * @param[in]  percent  (int) The percent of the wait, 0 for no aging.
+ */
+void ReadyQueue::setAging(int percent) {
+    agingPercent_ = percent;
+}
+
+/**
+ * @brief      Gets the order of a process under STR with aging.
+ *
+ * The aged time remaining of every queued process falls at the same rate,
+ * so subtracting the wait since a common time gives the same order as
+ * subtracting the wait until now. This key is the aged time remaining plus
+ * the aging of the whole run so far, in hundredths of a microsecond, and
+ * does not change while the process waits. The queue is kept in order as
+ * processes are inserted and never has to be sorted again.
+ *
+ * @param[in]  aProcess  (const Process&) A process
+ *
+ * @return     (long long) The key, lower runs first.
+ */
+long long ReadyQueue::agedKey(const Process& aProcess) const {
+    return aProcess.getProcessTimeRemain() * 100000LL + agingPercent_ * aProcess.getReadySince();
+}
+
+/**
+ * @brief      Sorts the ready queue by shortest time remaining in the
+ *             processes (STR) or by earliest deadline (EDF).
  */
 void ReadyQueue::sortReadyQueue() {
+    ScopedPhaseTimer timer("Ready queue sort");
+
     // Sort depending on scheduling algorithm
     if (schedCode_ == 0) { // RR
         // no sorting necessary
     }
+    else if ((schedCode_ == 1) && (agingPercent_ > 0)) { // STR with aging
+
+        // Already in order unless the queue was filled another way,
+        // e.g. restored from a checkpoint of another algorithm
+        auto agedBefore = [this](const Process& first, const Process& second) {
+                return agedKey(first) < agedKey(second);
+            };
+
+        if (!std::is_sorted(processVect_.begin(), processVect_.end(), agedBefore)) {
+            std::stable_sort(processVect_.begin(), processVect_.end(), agedBefore);
+        }
+    }
     else if (schedCode_ == 1) { // STR
 
         // STR: processes are executed in ascending order by the 
@@ -198,6 +271,59 @@ void ReadyQueue::sortReadyQueue() {
             processVect_[startScan] = tempMinObj;
         }
     }
+    else if (schedCode_ == 2) { // EDF
+
+        // EDF: processes are executed in ascending order by absolute
+        // deadline, those without one last. Equal deadlines keep their
+        // order, so the queue stays first come first served among them.
+        std::stable_sort(processVect_.begin(), processVect_.end(), earlierDeadline);
+    }
+}
+
+/**
+ * @brief      Compares two processes by deadline for EDF.
+ *
+ * @param[in]  first   (const Process&) A process
+ * @param[in]  second  (const Process&) Another process
+ *
+ * @return     (bool) True if the first must finish before the second.
+ */
+bool ReadyQueue::earlierDeadline(const Process& first, const Process& second) {
+    if (second.getDeadline() < 0) {
+        return first.getDeadline() >= 0;
+    }
+
+    return (first.getDeadline() >= 0) && (first.getDeadline() < second.getDeadline());
+}
+
+/**
+ * @brief      Writes the queued processes, in queue order, and the next
+ *             process number to a checkpoint. The scheduling algorithm is
+ *             not saved, it comes from the configuration.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void ReadyQueue::save(CheckpointWriter& out) const {
+    out.putInt(processArrivalIndx_);
+    out.putInt(processVect_.size());
+
+    for (unsigned int i = 0; i < processVect_.size(); i++) {
+        processVect_[i].save(out);
+    }
+}
+
+/**
+ * @brief      Reads the queue from a checkpoint.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void ReadyQueue::restore(CheckpointReader& in) {
+    processArrivalIndx_ = in.getInt();
+    processVect_.assign(in.getInt(), Process());
+
+    for (unsigned int i = 0; i < processVect_.size(); i++) {
+        processVect_[i].restore(in);
+    }
 }
 
 #endif
\ No newline at end of file
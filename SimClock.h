@@ -0,0 +1,175 @@
+/**
+ *  @file    SimClock.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _SIM_CLOCK
+#define _SIM_CLOCK
+
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+
+#include "Checkpoint.h"
+
+
+/**
+ * @brief      Class for the simulator's clock.
+ *
+ * In real time the clock reads the steady clock relative to the start of the
+ * simulation, and operations take as long as their cycle times. In virtual
+ * time the clock is a counter that only moves when an operation advances it,
+ * so a simulation runs as fast as the host allows. Time is kept in whole
+ * microseconds, the resolution of the log.
+ */
+class SimClock
+{
+public:
+    // Clock mode enum
+    enum Mode {REAL_TIME, VIRTUAL_TIME};
+
+    /**
+     * @brief      Default constructor starts a real time clock now.
+     */
+    SimClock() {
+        mode_ = REAL_TIME;
+        begin_ = std::chrono::steady_clock::now();
+        virtualNow_ = 0;
+    }
+
+    // GETTER FUNCTIONS
+    long long nowMicros() const;
+    double nowSeconds() const;
+    bool isVirtual() const;
+
+    // SETTER FUNCTIONS
+    void start(std::chrono::steady_clock::time_point begin, Mode mode);
+    void advance(long long micros);
+    void waitUntil(long long micros);
+
+    // PUBLIC FUNCTIONS
+    void save(CheckpointWriter& out) const;
+    void restore(CheckpointReader& in);
+
+private:
+    // PRIVATE DATA
+    Mode mode_;
+    std::chrono::steady_clock::time_point begin_; // start time
+    long long virtualNow_; // virtual time in microseconds
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Starts the clock.
+ *
+ * @param[in]  begin  (time_point) The start of the simulation
+ * @param[in]  mode   (Mode) Real or virtual time
+ */
+void SimClock::start(std::chrono::steady_clock::time_point begin, Mode mode) {
+    mode_ = mode;
+    begin_ = begin;
+    virtualNow_ = 0;
+}
+
+/**
+ * @brief      Gets the time since the start of the simulation.
+ *
+ * @return     (long long) The time in microseconds.
+ */
+long long SimClock::nowMicros() const {
+    if (mode_ == VIRTUAL_TIME) {
+        return virtualNow_;
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - begin_).count();
+}
+
+/**
+ * @brief      Gets the time since the start of the simulation, for timestamps.
+ *
+ * @return     (double) The time in seconds.
+ */
+double SimClock::nowSeconds() const {
+    if (mode_ == VIRTUAL_TIME) {
+        return virtualNow_ / 1000000.0;
+    }
+
+    std::chrono::duration<double> aDuration;
+    aDuration = (std::chrono::steady_clock::now() - begin_);
+    return aDuration.count();
+}
+
+/**
+ * @brief      Checks for virtual time.
+ *
+ * @return     true if the clock runs in virtual time.
+ */
+bool SimClock::isVirtual() const {
+    return mode_ == VIRTUAL_TIME;
+}
+
+/**
+ * @brief      Moves virtual time forward. Has no effect in real time, where
+ *             time is advanced by waiting.
+ *
+ * @param[in]  micros  (long long) The time to advance in microseconds
+ */
+void SimClock::advance(long long micros) {
+    if (mode_ == VIRTUAL_TIME) {
+        virtualNow_ += micros;
+    }
+}
+
+/**
+ * @brief      Waits until the clock reads the given time. In virtual time the
+ *             clock jumps there; in real time the calling thread sleeps.
+ *
+ * @param[in]  micros  (long long) The time to wait for in microseconds
+ */
+void SimClock::waitUntil(long long micros) {
+    if (mode_ == VIRTUAL_TIME) {
+        if (micros > virtualNow_) {
+            virtualNow_ = micros;
+        }
+        return;
+    }
+
+    std::this_thread::sleep_until(begin_ + std::chrono::microseconds(micros));
+}
+
+/**
+ * @brief      Writes the virtual time to a checkpoint.
+ *
+ * @param      out   (CheckpointWriter&) The checkpoint
+ */
+void SimClock::save(CheckpointWriter& out) const {
+    if (mode_ != VIRTUAL_TIME) {
+        // throw exception
+        throw std::logic_error("SimClock Class: Only Virtual Time Can Be Checkpointed");
+    }
+
+    out.putInt(virtualNow_);
+}
+
+/**
+ * @brief      Reads the virtual time from a checkpoint.
+ *
+ * @param      in    (CheckpointReader&) The checkpoint
+ */
+void SimClock::restore(CheckpointReader& in) {
+    if (mode_ != VIRTUAL_TIME) {
+        // throw exception
+        throw std::logic_error("SimClock Class: Only Virtual Time Can Be Checkpointed");
+    }
+
+    virtualNow_ = in.getInt();
+}
+
+#endif
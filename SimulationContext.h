@@ -0,0 +1,125 @@
+/**
+ *  @file    SimulationContext.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _SIMULATION_CONTEXT
+#define _SIMULATION_CONTEXT
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <pthread.h>
+
+#include "DeviceRegistry.h"
+#include "UnitFreeList.h"
+#include "PhaseProfiler.h"
+#include "LockStatistics.h"
+
+
+/**
+ * @brief      Class for the synchronization and device state of one
+ *             simulation.
+ *
+ * Every OSprocessRunner owns its own context, so any number of simulations
+ * can run at once on different threads of the same process without sharing
+ * locks or device units.
+ */
+class SimulationContext
+{
+public:
+    // OVERLOADED CONSTRUCTOR
+    explicit SimulationContext(const DeviceRegistry& devices) {
+        numDevices_ = devices.size();
+        freeUnits_.reset(new UnitFreeList[numDevices_]);
+
+        for (int i = 0; i < numDevices_; i++) {
+            freeUnits_[i].initialize(devices.get(i).quantity);
+            deviceNames_.push_back(devices.get(i).name);
+        }
+    }
+
+    // PUBLIC FUNCTIONS
+    void lockReadyQueue();
+    void unlockReadyQueue();
+    void enableLockStatistics();
+    void writeLockStatistics(std::ostream& out) const;
+
+    // GETTER FUNCTIONS
+    UnitFreeList& getFreeUnits(int deviceIndex);
+
+private:
+    // The lock and the units belong to one simulation
+    SimulationContext(const SimulationContext&);
+    SimulationContext& operator=(const SimulationContext&);
+
+    // PRIVATE DATA
+    InstrumentedMutex rdyQLock_; // guards the ready queue
+    std::unique_ptr<UnitFreeList[]> freeUnits_; // free units of each device, indexed like the registry
+    std::vector<std::string> deviceNames_; // for the lock statistics
+    int numDevices_;
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+void SimulationContext::lockReadyQueue() {
+    ScopedPhaseTimer timer("Ready queue lock wait");
+
+    rdyQLock_.lock();
+}
+
+void SimulationContext::unlockReadyQueue() {
+    rdyQLock_.unlock();
+}
+
+/**
+ * @brief      Starts recording the contention on the ready queue lock and
+ *             on the units of every device. Must be called before any
+ *             thread uses them.
+ */
+void SimulationContext::enableLockStatistics() {
+    rdyQLock_.getStatistics().enable("rdyQLock");
+
+    for (int i = 0; i < numDevices_; i++) {
+        freeUnits_[i].getStatistics().enable(deviceNames_[i] + " units");
+    }
+}
+
+/**
+ * @brief      Writes the statistics of every lock that has been acquired.
+ *
+ * @param[in]  (std::ostream&) out  An ostream reference object used to output
+ *                                  the statistics.
+ */
+void SimulationContext::writeLockStatistics(std::ostream& out) const {
+    out << "Lock statistics:" << std::endl;
+
+    if (rdyQLock_.getStatistics().getAcquisitions() > 0) {
+        rdyQLock_.getStatistics().write(out);
+    }
+
+    for (int i = 0; i < numDevices_; i++) {
+        if (freeUnits_[i].getStatistics().getAcquisitions() > 0) {
+            freeUnits_[i].getStatistics().write(out);
+        }
+    }
+}
+
+/**
+ * @brief      Gets the free units of a device.
+ *
+ * @param[in]  deviceIndex  (int) Index of the device in the registry
+ *
+ * @return     (UnitFreeList&) The free units.
+ */
+UnitFreeList& SimulationContext::getFreeUnits(int deviceIndex) {
+    return freeUnits_[deviceIndex];
+}
+
+#endif
@@ -0,0 +1,240 @@
+/**
+ *  @file    UnitFreeList.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _UNIT_FREE_LIST
+#define _UNIT_FREE_LIST
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <pthread.h>
+
+#include "LockStatistics.h"
+
+// Marks the end of the free-list
+const uint32_t NO_UNIT = 0xffffffffu;
+
+/**
+ * @brief      Class for the free units of one I/O device.
+ *
+ * Units are numbered 0 to quantity - 1. The free units form a lock-free
+ * stack: the head word holds the top unit in its low 32 bits and a counter
+ * in its high 32 bits, bumped on every change so that a pop cannot succeed
+ * against a head that was popped and pushed back in between (the ABA
+ * problem). Acquire and release only touch the stack while units are free.
+ * A thread that finds the stack empty parks on the device's condition
+ * variable, and a release only takes the device's own mutex when a thread
+ * is parked. With statistics enabled the device counts as a lock: an
+ * acquire that parks is contended, and a unit is held until it is released.
+ */
+class UnitFreeList
+{
+public:
+    // Default Constructor
+    UnitFreeList() {
+        head_ = pack(NO_UNIT, 0);
+        numParked_ = 0;
+        numBusy_ = 0;
+        quantity_ = 0;
+        pthread_mutex_init(&parkLock_, NULL);
+        pthread_cond_init(&unitFreed_, NULL);
+    }
+
+    // Destructor
+    ~UnitFreeList() {
+        pthread_cond_destroy(&unitFreed_);
+        pthread_mutex_destroy(&parkLock_);
+    }
+
+    // PUBLIC FUNCTIONS
+    void initialize(int quantity);
+    int tryAcquire();
+    int acquire();
+    void release(int unit);
+
+    // GETTER FUNCTIONS
+    int getQuantity() const;
+    int getNumBusy() const;
+    LockStatistics& getStatistics();
+    const LockStatistics& getStatistics() const;
+
+private:
+    // Units are not copied, they are handed out by number
+    UnitFreeList(const UnitFreeList&);
+    UnitFreeList& operator=(const UnitFreeList&);
+
+    // PRIVATE DATA
+    std::atomic<uint64_t> head_; // tag << 32 | top unit
+    // the unit below each unit on the stack, atomic because a pop may read
+    // it while a push writes it (the pop then fails on the tag)
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    int quantity_;
+    std::atomic<int> numParked_; // threads waiting for a unit
+    std::atomic<int> numBusy_; // units handed out, for sampling only
+    pthread_mutex_t parkLock_;
+    pthread_cond_t unitFreed_;
+    std::unique_ptr<long long[]> acquiredAt_; // nanoseconds, written by each unit's holder
+    LockStatistics statistics_;
+
+    // PRIVATE FUNCTIONS
+    static uint64_t pack(uint32_t unit, uint32_t tag);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Makes every unit free. Not safe while units are in use.
+ *
+ * @param[in]  quantity  (int) The number of units
+ */
+void UnitFreeList::initialize(int quantity) {
+    quantity_ = quantity;
+    next_.reset(new std::atomic<uint32_t>[quantity]);
+    acquiredAt_.reset(new long long[quantity]());
+
+    // unit 0 on top so that units are handed out in order
+    for (int unit = 0; unit < quantity; unit++) {
+        next_[unit] = (unit < (quantity - 1)) ? (uint32_t)(unit + 1) : NO_UNIT;
+    }
+
+    head_.store(pack((quantity > 0) ? 0 : NO_UNIT, 0));
+    numBusy_ = 0;
+}
+
+/**
+ * @brief      Takes a free unit without waiting.
+ *
+ * @return     (int) The unit number, -1 if none are free.
+ */
+int UnitFreeList::tryAcquire() {
+    uint64_t head = head_.load();
+
+    while ((uint32_t)head != NO_UNIT) {
+        uint32_t unit = (uint32_t)head;
+        uint64_t newHead = pack(next_[unit], (uint32_t)(head >> 32) + 1);
+
+        // on failure head is reloaded and the pop retried
+        if (head_.compare_exchange_weak(head, newHead)) {
+            numBusy_++;
+            return unit;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief      Takes a free unit, parking until one is released if none are
+ *             free.
+ *
+ * @return     (int) The unit number.
+ */
+int UnitFreeList::acquire() {
+    int unit = tryAcquire();
+
+    if (unit >= 0) {
+        if (statistics_.isEnabled()) {
+            acquiredAt_[unit] = LockStatistics::nowNanos();
+            statistics_.recordAcquire(false, 0);
+        }
+        return unit;
+    }
+
+    long long waitStart = statistics_.isEnabled() ? LockStatistics::nowNanos() : 0;
+
+    // Slow path: register as parked before checking again, so that a
+    // release between the check and the wait still signals this thread.
+    // The atomics are sequentially consistent so that a release either
+    // sees the parked count or its unit is seen by the second check.
+    pthread_mutex_lock(&parkLock_);
+    numParked_++;
+
+    while ((unit = tryAcquire()) < 0) {
+        pthread_cond_wait(&unitFreed_, &parkLock_);
+    }
+
+    numParked_--;
+    pthread_mutex_unlock(&parkLock_);
+
+    if (statistics_.isEnabled()) {
+        acquiredAt_[unit] = LockStatistics::nowNanos();
+        statistics_.recordAcquire(true, acquiredAt_[unit] - waitStart);
+    }
+
+    return unit;
+}
+
+/**
+ * @brief      Returns a unit and wakes one parked thread, if any.
+ *
+ * @param[in]  unit  (int) The unit number
+ */
+void UnitFreeList::release(int unit) {
+    uint64_t head = head_.load();
+    uint64_t newHead;
+
+    if (statistics_.isEnabled()) {
+        statistics_.recordHold(LockStatistics::nowNanos() - acquiredAt_[unit]);
+    }
+
+    do {
+        next_[unit] = (uint32_t)head;
+        newHead = pack(unit, (uint32_t)(head >> 32) + 1);
+    } while (!head_.compare_exchange_weak(head, newHead));
+
+    numBusy_--;
+
+    if (numParked_.load() > 0) {
+        pthread_mutex_lock(&parkLock_);
+        pthread_cond_signal(&unitFreed_);
+        pthread_mutex_unlock(&parkLock_);
+    }
+}
+
+/**
+ * @brief      Gets the number of units.
+ *
+ * @return     (int) The number of units.
+ */
+int UnitFreeList::getQuantity() const {
+    return quantity_;
+}
+
+/**
+ * @brief      Gets the number of units handed out. Other threads may change
+ *             it at any time, so it is only a snapshot.
+ *
+ * @return     (int) The number of busy units.
+ */
+int UnitFreeList::getNumBusy() const {
+    return numBusy_.load();
+}
+
+LockStatistics& UnitFreeList::getStatistics() {
+    return statistics_;
+}
+
+const LockStatistics& UnitFreeList::getStatistics() const {
+    return statistics_;
+}
+
+/**
+ * @brief      Packs a unit and a tag into a head word.
+ *
+ * @param[in]  unit  (uint32_t) The top unit
+ * @param[in]  tag   (uint32_t) The change counter
+ *
+ * @return     (uint64_t) The head word.
+ */
+uint64_t UnitFreeList::pack(uint32_t unit, uint32_t tag) {
+    return ((uint64_t)tag << 32) | unit;
+}
+
+#endif
@@ -0,0 +1,592 @@
+/**
+ *  @file    WorkloadGenerator.h
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ */
+
+#ifndef _WORKLOAD_GENERATOR
+#define _WORKLOAD_GENERATOR
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <sstream>
+#include <regex>
+#include <cmath>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "RandomSource.h"
+
+
+/**
+ * @brief      Class for a cycle count distribution parsed from a spec string.
+ *
+ * Spec strings:
+ *     fixed:N            always N
+ *     uniform:LO:HI      uniform integer in [LO, HI]
+ *     exp:MEAN           exponential with the given mean
+ *     pareto:ALPHA:MIN   heavy-tailed Pareto with shape ALPHA and scale MIN
+ *     pareto:ALPHA:MIN:MAX  as above, truncated at MAX
+ */
+class Distribution
+{
+public:
+    enum Kind {FIXED, UNIFORM, EXPONENTIAL, PARETO};
+
+    /**
+     * @brief      Default constructor is a fixed distribution of one.
+     */
+    Distribution() {
+        kind_ = FIXED;
+        a_ = 1;
+        b_ = 1;
+        c_ = 0;
+    }
+
+    // PUBLIC FUNCTIONS
+    void parse(std::string spec);
+    long sample(RandomSource& rng) const;
+
+private:
+    // PRIVATE DATA
+    Kind kind_;
+    double a_;
+    double b_;
+    double c_; // truncation bound for pareto, 0 for none
+};
+
+
+/**
+ * @brief      Class for a weighted choice between named items, parsed from
+ *             a spec string of the form "name=weight,name=weight".
+ */
+class WeightedChoice
+{
+public:
+    // PUBLIC FUNCTIONS
+    void parse(std::string spec);
+    void add(std::string name, double weight);
+    int choose(RandomSource& rng) const;
+    std::string getName(int index) const;
+    int size() const;
+    double getWeight(int index) const;
+
+private:
+    // PRIVATE DATA
+    std::vector<std::string> names_;
+    std::vector<double> cumulative_;
+};
+
+
+/**
+ * @brief      Class for generating synthetic meta data files.
+ *
+ * Every process is A{begin}0; followed by a number of operations drawn from
+ * the operations distribution, then A{finish}0;. Each operation is a
+ * processor run, an input, an output or a memory operation chosen from the
+ * operation mix. Devices and memory descriptors are chosen from their own
+ * mixes, and cycle counts are drawn from the cycles distribution.
+ */
+class WorkloadGenerator
+{
+public:
+    // Default Constructor
+    WorkloadGenerator() {
+        seed_ = 1;
+        numProcesses_ = 10;
+        commandsPerLine_ = 5;
+        opsDist_.parse("uniform:1:8");
+        runCycles_.parse("uniform:1:20");
+        ioCycles_.parse("uniform:1:20");
+        memCycles_.parse("uniform:1:4");
+        interArrival_.parse("exp:100");
+        opMix_.parse("run=4,input=2,output=2,memory=2");
+        inputMix_.parse("hard drive=2,keyboard=1");
+        outputMix_.parse("hard drive=2,monitor=1,projector=1");
+        memoryMix_.parse("allocate=1,block=1");
+    }
+
+    // SETTER FUNCTIONS
+    void setSeed(uint64_t seed);
+    void setNumProcesses(long numProcesses);
+    void setCommandsPerLine(int commandsPerLine);
+    void setOpsDistribution(std::string spec);
+    void setRunCycles(std::string spec);
+    void setIOCycles(std::string spec);
+    void setMemoryCycles(std::string spec);
+    void setInterArrival(std::string spec);
+    void setOperationMix(std::string spec);
+    void setInputMix(std::string spec);
+    void setOutputMix(std::string spec);
+    void setMemoryMix(std::string spec);
+
+    // PUBLIC FUNCTIONS
+    void writeMDF(std::ostream& out);
+    void writeArrivals(std::ostream& out);
+
+private:
+    // PRIVATE DATA
+    uint64_t seed_;
+    long numProcesses_;
+    int commandsPerLine_;
+    Distribution opsDist_;
+    Distribution runCycles_;
+    Distribution ioCycles_;
+    Distribution memCycles_;
+    Distribution interArrival_;
+    WeightedChoice opMix_;
+    WeightedChoice inputMix_;
+    WeightedChoice outputMix_;
+    WeightedChoice memoryMix_;
+
+    // PRIVATE FUNCTIONS
+    void writeCommand(std::ostream& out, char code, const std::string& descriptor,
+                      long cycles, int& column);
+};
+
+//******************************************************************************
+// IMPLEMENTATION
+//******************************************************************************
+
+/**
+ * @brief      Parses a distribution spec string (see class description).
+ *
+ * @param[in]  spec  (std::string) The spec string
+ */
+void Distribution::parse(std::string spec) {
+    // split on ':'
+    std::vector<std::string> fields;
+    std::stringstream stream(spec);
+    std::string field;
+
+    while (std::getline(stream, field, ':')) {
+        fields.push_back(field);
+    }
+
+    if (fields.empty()) {
+        // throw exception
+        throw std::logic_error("Distribution Class: Empty Distribution Spec");
+    }
+
+    std::vector<double> params;
+    for (unsigned int i = 1; i < fields.size(); i++) {
+        params.push_back(atof(fields[i].c_str()));
+    }
+
+    c_ = 0;
+
+    if ((fields[0] == "fixed") && (params.size() == 1)) {
+        kind_ = FIXED;
+        a_ = params[0];
+        b_ = params[0];
+    }
+    else if ((fields[0] == "uniform") && (params.size() == 2)) {
+        kind_ = UNIFORM;
+        a_ = params[0];
+        b_ = params[1];
+    }
+    else if ((fields[0] == "exp") && (params.size() == 1)) {
+        kind_ = EXPONENTIAL;
+        a_ = params[0];
+        b_ = 0;
+    }
+    else if ((fields[0] == "pareto") && ((params.size() == 2) || (params.size() == 3))) {
+        kind_ = PARETO;
+        a_ = params[0];
+        b_ = params[1];
+        if (params.size() == 3) {
+            c_ = params[2];
+        }
+        if (a_ <= 0) {
+            // throw exception
+            throw std::logic_error("Distribution Class: Pareto Shape Must Be Above Zero");
+        }
+    }
+    else {
+        // throw exception
+        throw std::logic_error("Distribution Class: Invalid Distribution Spec '" + spec + "'");
+    }
+
+    if ((a_ < 0) || (b_ < 0) || (c_ < 0) || ((kind_ == UNIFORM) && (b_ < a_))) {
+        // throw exception
+        throw std::logic_error("Distribution Class: Invalid Distribution Parameters '" + spec + "'");
+    }
+
+    // a uniform draw is returned as is, so its bounds must fit the fields
+    if (kind_ == UNIFORM) {
+        a_ = std::min(a_, (double)INT_MAX);
+        b_ = std::min(b_, (double)INT_MAX);
+    }
+}
+
+/**
+ * @brief      Draws one value from the distribution.
+ *
+ * @param[in]  rng   (RandomSource&) The random source
+ *
+ * @return     (long) The value, never less than zero nor more than INT_MAX.
+ */
+long Distribution::sample(RandomSource& rng) const {
+    double value = 0;
+
+    switch (kind_) {
+        case FIXED:
+            value = a_;
+            break;
+        case UNIFORM:
+        {
+            long lo = (long)a_;
+            long hi = (long)b_;
+            return lo + (long)rng.nextBelow(hi - lo + 1);
+        }
+        case EXPONENTIAL:
+            value = rng.nextExponential(a_);
+            break;
+        case PARETO:
+            value = b_ / std::pow(rng.nextOpenUnit(), 1.0 / a_);
+            if ((c_ > 0) && (value > c_)) {
+                value = c_;
+            }
+            break;
+    }
+
+    // a heavy tail can draw values no field could hold, even infinity
+    if (value > INT_MAX) {
+        value = INT_MAX;
+    }
+
+    return (long)std::floor(value + 0.5);
+}
+
+/**
+ * @brief      Parses a "name=weight,name=weight" spec string. Replaces any
+ *             items already added.
+ *
+ * @param[in]  spec  (std::string) The spec string
+ */
+void WeightedChoice::parse(std::string spec) {
+    names_.clear();
+    cumulative_.clear();
+
+    std::stringstream stream(spec);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        std::string::size_type equals = item.find('=');
+
+        if (equals == std::string::npos) {
+            // throw exception
+            throw std::logic_error("WeightedChoice Class: Missing '=' In '" + item + "'");
+        }
+
+        add(item.substr(0, equals), atof(item.substr(equals + 1).c_str()));
+    }
+
+    if (names_.empty() || (cumulative_.back() <= 0)) {
+        // throw exception
+        throw std::logic_error("WeightedChoice Class: Weights Must Sum Above Zero");
+    }
+}
+
+/**
+ * @brief      Adds an item with its weight.
+ *
+ * @param[in]  name    (std::string) The item name
+ * @param[in]  weight  (double) The item weight, zero or more
+ */
+void WeightedChoice::add(std::string name, double weight) {
+    if (weight < 0) {
+        // throw exception
+        throw std::logic_error("WeightedChoice Class: Weight is Less Than Zero");
+    }
+
+    double total = cumulative_.empty() ? 0 : cumulative_.back();
+
+    names_.push_back(name);
+    cumulative_.push_back(total + weight);
+}
+
+/**
+ * @brief      Chooses an item with probability proportional to its weight.
+ *
+ * @param[in]  rng   (RandomSource&) The random source
+ *
+ * @return     (int) The index of the chosen item.
+ */
+int WeightedChoice::choose(RandomSource& rng) const {
+    double target = rng.nextUnit() * cumulative_.back();
+
+    for (unsigned int i = 0; i < cumulative_.size(); i++) {
+        if (target < cumulative_[i]) {
+            return i;
+        }
+    }
+
+    return cumulative_.size() - 1;
+}
+
+/**
+ * @brief      Gets the name of an item.
+ *
+ * @param[in]  index  (int) The item index
+ *
+ * @return     (std::string) The name.
+ */
+std::string WeightedChoice::getName(int index) const {
+    return names_.at(index);
+}
+
+/**
+ * @brief      Gets the number of items.
+ *
+ * @return     (int) The number of items.
+ */
+int WeightedChoice::size() const {
+    return names_.size();
+}
+
+/**
+ * @brief      Gets the weight of an item.
+ *
+ * @param[in]  index  (int) The item index
+ *
+ * @return     (double) The weight.
+ */
+double WeightedChoice::getWeight(int index) const {
+    return cumulative_.at(index) - ((index == 0) ? 0 : cumulative_.at(index - 1));
+}
+
+void WorkloadGenerator::setSeed(uint64_t seed) {
+    seed_ = seed;
+}
+
+void WorkloadGenerator::setNumProcesses(long numProcesses) {
+    if (numProcesses < 1) {
+        // throw exception
+        throw std::logic_error("WorkloadGenerator Class: Number of Processes is Less Than One");
+    }
+    numProcesses_ = numProcesses;
+}
+
+void WorkloadGenerator::setCommandsPerLine(int commandsPerLine) {
+    if (commandsPerLine < 1) {
+        // throw exception
+        throw std::logic_error("WorkloadGenerator Class: Commands Per Line is Less Than One");
+    }
+    commandsPerLine_ = commandsPerLine;
+}
+
+void WorkloadGenerator::setOpsDistribution(std::string spec) {
+    opsDist_.parse(spec);
+}
+
+void WorkloadGenerator::setRunCycles(std::string spec) {
+    runCycles_.parse(spec);
+}
+
+void WorkloadGenerator::setIOCycles(std::string spec) {
+    ioCycles_.parse(spec);
+}
+
+void WorkloadGenerator::setMemoryCycles(std::string spec) {
+    memCycles_.parse(spec);
+}
+
+void WorkloadGenerator::setInterArrival(std::string spec) {
+    interArrival_.parse(spec);
+}
+
+/**
+ * @brief      Sets the operation mix. Names must be run, input, output or memory.
+ *
+ * @param[in]  spec  (std::string) The weighted choice spec
+ */
+void WorkloadGenerator::setOperationMix(std::string spec) {
+    WeightedChoice mix;
+    mix.parse(spec);
+
+    for (int i = 0; i < mix.size(); i++) {
+        std::string name = mix.getName(i);
+        if ((name != "run") && (name != "input") && (name != "output") && (name != "memory")) {
+            // throw exception
+            throw std::logic_error("WorkloadGenerator Class: Invalid Operation '" + name + "'");
+        }
+    }
+
+    // Keep a fixed order so that the code lookup in writeMDF() is by index
+    opMix_ = WeightedChoice();
+    const std::string OPS[] = {"run", "input", "output", "memory"};
+    for (int op = 0; op < 4; op++) {
+        double weight = 0;
+        for (int i = 0; i < mix.size(); i++) {
+            if (mix.getName(i) == OPS[op]) {
+                weight += mix.getWeight(i);
+            }
+        }
+        opMix_.add(OPS[op], weight);
+    }
+}
+
+/**
+ * @brief      Sets the input device mix. Names must be device descriptors;
+ *             the simulator checks them against its configured devices.
+ *
+ * @param[in]  spec  (std::string) The weighted choice spec
+ */
+void WorkloadGenerator::setInputMix(std::string spec) {
+    inputMix_.parse(spec);
+
+    for (int i = 0; i < inputMix_.size(); i++) {
+        std::string name = inputMix_.getName(i);
+        if (!std::regex_match(name, std::regex("[a-z ]+"))) {
+            // throw exception
+            throw std::logic_error("WorkloadGenerator Class: Invalid Input Device '" + name + "'");
+        }
+    }
+}
+
+/**
+ * @brief      Sets the output device mix. Names must be device descriptors;
+ *             the simulator checks them against its configured devices.
+ *
+ * @param[in]  spec  (std::string) The weighted choice spec
+ */
+void WorkloadGenerator::setOutputMix(std::string spec) {
+    outputMix_.parse(spec);
+
+    for (int i = 0; i < outputMix_.size(); i++) {
+        std::string name = outputMix_.getName(i);
+        if (!std::regex_match(name, std::regex("[a-z ]+"))) {
+            // throw exception
+            throw std::logic_error("WorkloadGenerator Class: Invalid Output Device '" + name + "'");
+        }
+    }
+}
+
+/**
+ * @brief      Sets the memory operation mix. Names must be allocate or block.
+ *
+ * @param[in]  spec  (std::string) The weighted choice spec
+ */
+void WorkloadGenerator::setMemoryMix(std::string spec) {
+    memoryMix_.parse(spec);
+
+    for (int i = 0; i < memoryMix_.size(); i++) {
+        std::string name = memoryMix_.getName(i);
+        if ((name != "allocate") && (name != "block")) {
+            // throw exception
+            throw std::logic_error("WorkloadGenerator Class: Invalid Memory Operation '" + name + "'");
+        }
+    }
+}
+
+/**
+ * @brief      Writes one command, wrapping the line after commandsPerLine_
+ *             commands.
+ *
+ * @param      out         (std::ostream&) The output stream
+ * @param[in]  code        (char) The code character
+ * @param[in]  descriptor  (std::string) The descriptor
+ * @param[in]  cycles      (long) The number of cycles
+ * @param      column      (int&) Commands already written on this line
+ */
+void WorkloadGenerator::writeCommand(std::ostream& out, char code, const std::string& descriptor,
+                                     long cycles, int& column) {
+    if (column == commandsPerLine_) {
+        out << '\n';
+        column = 0;
+    }
+    if (column > 0) {
+        out << ' ';
+    }
+
+    out << code << '{' << descriptor << '}' << cycles << ';';
+    column++;
+}
+
+/**
+ * @brief      Writes a complete meta data file for numProcesses_ processes.
+ *
+ * The same seed and settings always write the same file.
+ *
+ * @param      out   (std::ostream&) The output stream
+ */
+void WorkloadGenerator::writeMDF(std::ostream& out) {
+    RandomSource rng(seed_);
+    int column = 0;
+
+    out << "Start Program Meta-Data Code:\n";
+
+    writeCommand(out, 'S', "begin", 0, column);
+
+    for (long process = 0; process < numProcesses_; process++) {
+        writeCommand(out, 'A', "begin", 0, column);
+
+        long numOps = opsDist_.sample(rng);
+
+        for (long op = 0; op < numOps; op++) {
+            switch (opMix_.choose(rng)) {
+                case 0: // run
+                    writeCommand(out, 'P', "run", runCycles_.sample(rng), column);
+                    break;
+                case 1: // input
+                {
+                    std::string device = inputMix_.getName(inputMix_.choose(rng));
+                    writeCommand(out, 'I', device, ioCycles_.sample(rng), column);
+                    break;
+                }
+                case 2: // output
+                {
+                    std::string device = outputMix_.getName(outputMix_.choose(rng));
+                    writeCommand(out, 'O', device, ioCycles_.sample(rng), column);
+                    break;
+                }
+                case 3: // memory
+                {
+                    std::string memOp = memoryMix_.getName(memoryMix_.choose(rng));
+                    writeCommand(out, 'M', memOp, memCycles_.sample(rng), column);
+                    break;
+                }
+            }
+        }
+
+        writeCommand(out, 'A', "finish", 0, column);
+    }
+
+    writeCommand(out, 'S', "finish", 0, column);
+
+    out << "\nEnd Program Meta-Data Code.\n";
+}
+
+/**
+ * @brief      Writes the arrival schedule for numProcesses_ processes.
+ *
+ * Arrival times are in milliseconds from the start of the simulation, with
+ * gaps drawn from the inter-arrival distribution. The first process arrives
+ * at time zero. The schedule uses its own random stream so that changing it
+ * does not change the meta data file.
+ *
+ * @param      out   (std::ostream&) The output stream
+ */
+void WorkloadGenerator::writeArrivals(std::ostream& out) {
+    RandomSource rng(seed_ ^ 0x9e3779b97f4a7c15ULL);
+    long arrivalTime = 0;
+
+    out << "Start Process Arrival Schedule\n";
+
+    for (long process = 1; process <= numProcesses_; process++) {
+        if (process > 1) {
+            arrivalTime += interArrival_.sample(rng);
+        }
+        out << "Process " << process << ": " << arrivalTime << '\n';
+    }
+
+    out << "End Process Arrival Schedule\n";
+}
+
+#endif
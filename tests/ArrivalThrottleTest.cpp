@@ -0,0 +1,63 @@
+/**
+ *  @file    ArrivalThrottleTest.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Checks that a throttled arrival source pushes back its schedule
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <vector>
+
+#include "ArrivalSource.h"
+
+/**
+ * @brief      Holds the second of three arrivals 100 ms apart for 50 ms,
+ *             and checks when the third is due with and without throttling.
+ *
+ * @param[in]  throttle  (bool) Whether the source is throttled
+ *
+ * @return     (long long) The time of the third arrival in microseconds.
+ */
+long long thirdArrivalTime(bool throttle) {
+    ArrivalSource arrivals;
+    ReadyQueue readyQ;
+
+    arrivals.setWorkload(std::vector<Process>(1, Process()));
+    arrivals.buildReload(2, 100);
+
+    arrivals.deliverDue(0, readyQ, 1, throttle);
+
+    // the system is full when the second arrives
+    arrivals.holdDue(100000);
+    arrivals.deliverDue(150000, readyQ, 1, throttle);
+
+    return arrivals.nextArrivalTime();
+}
+
+/**
+ * @brief      Checks that Queue keeps the schedule and Throttle pushes the
+ *             rest of it back by the hold.
+ *
+ * @return     (int) 0 if the test passed, 1 if it failed
+ */
+int main()
+{
+    long long queued = thirdArrivalTime(false);
+    long long throttled = thirdArrivalTime(true);
+
+    if (queued != 200000) {
+        std::cout << "FAIL: queued third arrival at " << queued << ", expected 200000" << std::endl;
+        return 1;
+    }
+    if (throttled != 250000) {
+        std::cout << "FAIL: throttled third arrival at " << throttled << ", expected 250000" << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: ArrivalThrottleTest" << std::endl;
+    return 0;
+}
@@ -0,0 +1,45 @@
+/**
+ *  @file    DistributionTest.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Checks that workload distributions stay within INT_MAX
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <climits>
+
+#include "WorkloadGenerator.h"
+
+/**
+ * @brief      Draws from distributions whose bounds or tails go past
+ *             INT_MAX and checks that every value fits.
+ *
+ * @return     (int) 0 if the test passed, 1 if it failed
+ */
+int main()
+{
+    const char* specs[] = {"uniform:1:99999999999", "uniform:99999999999:99999999999",
+                           "fixed:99999999999", "pareto:0.05:10"};
+    RandomSource rng(1);
+
+    for (unsigned int s = 0; s < (sizeof(specs) / sizeof(specs[0])); s++) {
+        Distribution aDistribution;
+        aDistribution.parse(specs[s]);
+
+        for (int i = 0; i < 1000; i++) {
+            long value = aDistribution.sample(rng);
+
+            if ((value < 0) || (value > INT_MAX)) {
+                std::cout << "FAIL: " << specs[s] << " drew " << value << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    std::cout << "PASS: DistributionTest" << std::endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ *  @file    IdleQuantumTest.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Checks that a round robin quantum does not outlive an idle CPU
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <chrono>
+
+#include "OSprocessRunner.h"
+
+/**
+ * @brief      Runs a process that finishes within its quantum, idles the CPU
+ *             past the end of that quantum, then runs a second process under
+ *             round robin. The second process must start an operation before
+ *             it is interrupted.
+ *
+ * @return     (int) 0 if the test passed, 1 if it failed
+ */
+int main()
+{
+    std::string configPath = "IdleQuantumTest.conf";
+    std::string metaDataPath = "IdleQuantumTest.mdf";
+
+    std::ofstream metaData(metaDataPath.c_str());
+    metaData << "Start Program Meta-Data Code:" << std::endl
+             << "S{begin}0; A{begin}0@0; P{run}2; A{finish}0;" << std::endl
+             << "A{begin}0@500; P{run}30; A{finish}0; S{finish}0;" << std::endl
+             << "End Program Meta-Data Code." << std::endl;
+    metaData.close();
+
+    std::ofstream config(configPath.c_str());
+    config << "Start Simulator Configuration File" << std::endl
+           << "Version/Phase: 4.0" << std::endl
+           << "File Path: " << metaDataPath << std::endl
+           << "Quantum Number {msec}: 50" << std::endl
+           << "CPU Scheduling Code: RR" << std::endl
+           << "Processor cycle time {msec}: 5" << std::endl
+           << "Monitor display time {msec}: 20" << std::endl
+           << "Hard drive cycle time {msec}: 15" << std::endl
+           << "Projector cycle time {msec}: 25" << std::endl
+           << "Keyboard cycle time {msec}: 50" << std::endl
+           << "Memory cycle time {msec}: 10" << std::endl
+           << "System memory {kbytes}: 2048" << std::endl
+           << "Memory block size {kbytes}: 128" << std::endl
+           << "Projector quantity: 1" << std::endl
+           << "Hard drive quantity: 1" << std::endl
+           << "Log: Log to Monitor" << std::endl
+           << "Log File Path: IdleQuantumTest.lgf" << std::endl
+           << "Simulation clock: Virtual Time" << std::endl
+           << "Arrival mode: Schedule" << std::endl
+           << "End Simulator Configuration File" << std::endl;
+    config.close();
+
+    Configuration configObj;
+    configObj.parseConfigFile(configPath);
+
+    OSprocessRunner anApplication(std::chrono::steady_clock::now(), configObj);
+    anApplication.runProcesses();
+
+    std::remove(configPath.c_str());
+    std::remove(metaDataPath.c_str());
+
+    // process 2 arrives to an idle CPU
+    bool ranAfterIdle = false;
+
+    for (int index = 0; index < anApplication.getNumOperations(); index++) {
+        if (anApplication.getActor(index) != "Process 2") {
+            continue;
+        }
+
+        std::string description = anApplication.getOpDescription(index);
+
+        if (description.compare(0, 5, "start") == 0) {
+            ranAfterIdle = true;
+        }
+        else if ((!ranAfterIdle) && (description.find("interrupted") != std::string::npos)) {
+            std::cout << "FAIL: process 2 interrupted before its first operation" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!ranAfterIdle) {
+        std::cout << "FAIL: process 2 never started" << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: IdleQuantumTest" << std::endl;
+    return 0;
+}
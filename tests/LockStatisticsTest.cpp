@@ -0,0 +1,86 @@
+/**
+ *  @file    LockStatisticsTest.cpp
+ *  @author  Ian Vanderhoff
+ *  @date    10/18/2026
+ *  @version 1
+ *
+ *  @brief Checks the percentiles reported by LockStatistics
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <cmath>
+
+#include "LockStatistics.h"
+
+/**
+ * @brief      Checks that an estimate is within a tolerance of the exact
+ *             value, reporting it if not.
+ *
+ * @param[in]  name       (std::string) What is checked
+ * @param[in]  estimate   (double) The reported value
+ * @param[in]  exact      (double) The exact value
+ * @param[in]  tolerance  (double) The largest error allowed, as a fraction
+ *
+ * @return     true if the estimate is close enough.
+ */
+bool checkClose(std::string name, double estimate, double exact, double tolerance) {
+    if (std::fabs(estimate - exact) > (exact * tolerance)) {
+        std::cout << "FAIL: " << name << " is " << estimate << ", expected "
+                  << exact << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief      Feeds waits of 1 to 100 microseconds and holds of 10
+ *             microseconds, then checks the percentiles and the report.
+ *
+ * @return     (int) 0 if the test passed, 1 if it failed
+ */
+int main()
+{
+    LockStatistics statistics;
+    statistics.enable("test lock");
+
+    for (int i = 1; i <= 100; i++) {
+        statistics.recordAcquire(true, i * 1000LL);
+        statistics.recordHold(10000);
+    }
+
+    bool passed = true;
+
+    // the nearest rank percentiles of the waits are 50 and 99 usec
+    passed = checkClose("wait p50", statistics.getWaitPercentile(50), 50000, 0.05) && passed;
+    passed = checkClose("wait p99", statistics.getWaitPercentile(99), 99000, 0.05) && passed;
+
+    // every hold is the same, so the percentiles are that hold
+    passed = checkClose("hold p50", statistics.getHoldPercentile(50), 10000, 0.0) && passed;
+    passed = checkClose("hold p99", statistics.getHoldPercentile(99), 10000, 0.0) && passed;
+
+    // the report shows the same values in microseconds
+    std::ostringstream report;
+    statistics.write(report);
+
+    std::ostringstream expected;
+    expected << std::fixed;
+    expected.precision(3);
+    expected << "p50 " << (statistics.getWaitPercentile(50) / 1e3)
+             << ", p99 " << (statistics.getWaitPercentile(99) / 1e3) << ", max 100.000";
+
+    if (report.str().find(expected.str()) == std::string::npos) {
+        std::cout << "FAIL: report does not hold \"" << expected.str() << "\"" << std::endl
+                  << report.str();
+        passed = false;
+    }
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "PASS: LockStatisticsTest" << std::endl;
+    return 0;
+}